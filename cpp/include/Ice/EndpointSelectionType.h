@@ -39,7 +39,13 @@ enum class EndpointSelectionType : unsigned char
     /**
      * <code>Ordered</code> forces the Ice run time to use the endpoints in the order they appeared in the proxy.
      */
-    Ordered
+    Ordered,
+    /**
+     * <code>Adaptive</code> causes the endpoints to be arranged by increasing cost, the cost of an endpoint being
+     * its recent invocation latency weighted by its number of outstanding invocations. The connection is selected
+     * for each invocation, as if the proxy didn't cache its connection.
+     */
+    Adaptive
 };
 
 }
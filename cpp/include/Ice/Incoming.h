@@ -68,6 +68,7 @@ public:
     void endWriteParams();
     void writeEmptyParams();
     void writeParamEncaps(const Ice::Byte*, std::int32_t, bool);
+    void writeReply(const Ice::Byte*, const Ice::Byte*);
     void setMarshaledResult(const Ice::MarshaledResult&);
 
     void response(bool);
@@ -162,11 +163,18 @@ public:
         _current.encoding = _is->readEncapsulation(v, sz);
     }
 
+    // The start of the encoded request, the request ends with the in-parameters encapsulation.
+    const Ice::Byte* requestPos() const
+    {
+        return _requestPos;
+    }
+
 private:
 
     friend class IncomingAsync;
 
     Ice::InputStream* _is;
+    Ice::Byte* _requestPos;
     Ice::Byte* _inParamPos;
 
     IncomingAsyncPtr _inAsync;
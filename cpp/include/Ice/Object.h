@@ -247,6 +247,43 @@ public:
     /// \endcond
 };
 
+/**
+ * Base class for asynchronous dynamic dispatch servants that forward requests. In addition to the
+ * in-parameters, the servant receives the encoded request, which it can forward with
+ * ObjectPrx::ice_forwardAsync without marshaling the request again.
+ * \headerfile Ice/Ice.h
+ */
+class ICE_API BlobjectForwardAsync : public virtual Object
+{
+public:
+
+    /**
+     * Dispatch an incoming request asynchronously.
+     *
+     * @param request The encoded request, from the identity of the target to the end of the in-parameters.
+     * @param inEncaps An encapsulation containing the encoded in-parameters for the operation.
+     * @param response A callback the implementation should invoke when the invocation completes
+     * successfully or with a user exception. See the description of Blobject::ice_invoke for
+     * the semantics.
+     * @param reply A callback the implementation should invoke with the encoded reply of a request
+     * forwarded with ObjectPrx::ice_forwardAsync.
+     * @param error A callback the implementation should invoke when the invocation completes
+     * with an exception.
+     * @param current The Current object for the invocation.
+     * @throws UserException A user exception can be raised directly and the
+     * run time will marshal it.
+     */
+    virtual void ice_invokeAsync(std::pair<const Byte*, const Byte*> request,
+                                 std::pair<const Byte*, const Byte*> inEncaps,
+                                 std::function<void(bool, const std::pair<const Byte*, const Byte*>&)> response,
+                                 std::function<void(const std::pair<const Byte*, const Byte*>&)> reply,
+                                 std::function<void(std::exception_ptr)> error,
+                                 const Current& current) = 0;
+    /// \cond INTERNAL
+    virtual bool _iceDispatch(IceInternal::Incoming&, const Current&);
+    /// \endcond
+};
+
 }
 
 #endif
@@ -25,6 +25,7 @@ namespace IceInternal
 class OutgoingAsyncBase;
 class RetryException;
 class CollocatedRequestHandler;
+class EndpointStats;
 
 class ICE_API OutgoingAsyncCompletionCallback
 {
@@ -69,13 +70,13 @@ public:
 
     void attachRemoteObserver(const Ice::ConnectionInfoPtr& c, const Ice::EndpointPtr& endpt, std::int32_t requestId)
     {
-        const std::int32_t size = static_cast<std::int32_t>(_os.b.size() - headerSize - 4);
+        const std::int32_t size = static_cast<std::int32_t>(_os.b.size() + _os.borrowed().b.size() - headerSize - 4);
         _childObserver.attach(getObserver().getRemoteObserver(c, endpt, requestId, size));
     }
 
     void attachCollocatedObserver(const Ice::ObjectAdapterPtr& adapter, std::int32_t requestId)
     {
-        const std::int32_t size = static_cast<std::int32_t>(_os.b.size() - headerSize - 4);
+        const std::int32_t size = static_cast<std::int32_t>(_os.b.size() + _os.borrowed().b.size() - headerSize - 4);
         _childObserver.attach(getObserver().getCollocatedObserver(adapter, requestId, size));
     }
 
@@ -176,6 +177,9 @@ protected:
 
     virtual void runTimerTask();
 
+    void endpointStatsStarted(const Ice::ConnectionIPtr&);
+    void endpointStatsFinished(bool);
+
     const Ice::ObjectPrx _proxy;
     RequestHandlerPtr _handler;
     Ice::OperationMode _mode;
@@ -184,6 +188,15 @@ private:
 
     int _cnt;
     bool _sent;
+
+    //
+    // The stats of the endpoint of the connection used by a twoway
+    // invocation with the adaptive endpoint selection. It's set when the
+    // invocation is sent and reset by the first completion, it's loaded
+    // and stored atomically as the completions can race.
+    //
+    std::shared_ptr<EndpointStats> _endpointStats;
+    std::chrono::steady_clock::time_point _endpointStatsTime;
 };
 
 using ProxyOutgoingAsyncBasePtr = ::std::shared_ptr<ProxyOutgoingAsyncBase>;
@@ -867,6 +867,18 @@ public:
 
     // Optionals
     bool writeOptImpl(std::int32_t, OptionalFormat);
+
+    //
+    // Bytes written at the end of the stream by reference instead of being copied
+    // into the stream buffer. They must remain valid until the stream is sent or
+    // until copyBorrowed() is called. Nothing can be written after borrowed bytes.
+    //
+    void writeBorrowed(const Byte*, const Byte*);
+    void copyBorrowed();
+    IceInternal::Buffer& borrowed()
+    {
+        return _borrowed;
+    }
     /// \endcond
 
 private:
@@ -1090,6 +1102,8 @@ private:
     void initEncaps();
 
     Encaps _preAllocatedEncaps;
+
+    IceInternal::Buffer _borrowed;
 };
 
 } // End namespace Ice
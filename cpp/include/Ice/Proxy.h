@@ -129,6 +129,19 @@ public:
         return fromReference(asPrx()._connectionCached(b));
     }
 
+    /**
+     * Obtains a proxy that is identical to this proxy, except for the size of its connection pool.
+     * Twoway invocations are spread over this number of connections for each endpoint, while
+     * oneway, batch and datagram invocations use a single connection of the pool to preserve
+     * their ordering.
+     * @param size The number of connections, which must be at least 1.
+     * @return A proxy with the specified connection pool size.
+     */
+    Prx ice_connectionPoolSize(int size) const
+    {
+        return fromReference(asPrx()._connectionPoolSize(size));
+    }
+
     /**
      * Obtains a proxy that is identical to this proxy, except for its connection ID.
      * @param id The connection ID for the new proxy. An empty string removes the
@@ -576,6 +589,25 @@ public:
                     std::function<void(bool)> sent = nullptr,
                     const Ice::Context& context = Ice::noExplicitContext) const;
 
+    /**
+     * Forwards a request received by a BlobjectForwardAsync servant. The encoded request is sent
+     * unchanged, so the identity, facet and context of this proxy aren't used and the target
+     * receives the identity, facet and context of the forwarded request.
+     * @param request The encoded request received by the servant.
+     * @param response The response callback, it receives the encoded reply which the servant can
+     * pass to its reply callback.
+     * @param ex The exception callback.
+     * @param sent The sent callback.
+     * @param current The Current object of the forwarded request.
+     * @return A function that can be called to cancel the invocation locally.
+     */
+    std::function<void()>
+    ice_forwardAsync(const std::pair<const Ice::Byte*, const Ice::Byte*>& request,
+                     std::function<void(std::pair<const Ice::Byte*, const Ice::Byte*>)> response,
+                     std::function<void(std::exception_ptr)> ex,
+                     std::function<void(bool)> sent,
+                     const Ice::Current& current) const;
+
     /**
      * Obtains the Connection for this proxy. If the proxy does not yet have an established connection,
      * it first attempts to create a connection.
@@ -692,6 +724,12 @@ public:
      */
     bool ice_isConnectionCached() const;
 
+    /**
+     * Obtains the size of the connection pool of this proxy.
+     * @return The number of connections used by this proxy for each endpoint.
+     */
+    std::int32_t ice_getConnectionPoolSize() const;
+
     /**
      * Obtains the endpoint selection policy for this proxy (randomly or ordered).
      * @return The endpoint selection policy.
@@ -854,6 +892,7 @@ private:
     IceInternal::ReferencePtr _compress(bool) const;
     IceInternal::ReferencePtr _connectionCached(bool) const;
     IceInternal::ReferencePtr _connectionId(const std::string&) const;
+    IceInternal::ReferencePtr _connectionPoolSize(int) const;
     IceInternal::ReferencePtr _context(const Context&) const;
     IceInternal::ReferencePtr _datagram() const;
     IceInternal::ReferencePtr _encodingVersion(const EncodingVersion&) const;
@@ -37,7 +37,13 @@ class ICE_API Timer
 public:
 
     Timer();
-    virtual ~Timer() = default;
+
+    // Create a timer which keeps its tasks in a hierarchical timing wheel with the given resolution instead of an
+    // ordered set. Scheduling and canceling a task take constant time but a task runs up to one tick after its
+    // scheduled time. It's intended for timers with many timeout tasks which are usually canceled before they run.
+    // A zero resolution creates an ordered timer.
+    explicit Timer(std::chrono::milliseconds);
+    virtual ~Timer();
 
     // Destroy the timer and detach its execution thread if the calling thread
     // is the timer thread, join the timer execution thread otherwise.
@@ -47,70 +53,14 @@ public:
     template<class Rep, class Period>
     void schedule(const TimerTaskPtr& task, const std::chrono::duration<Rep, Period>& delay)
     {
-        std::lock_guard lock(_mutex);
-        if (_destroyed)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
-        }
-
-        if (delay < std::chrono::nanoseconds::zero())
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "invalid negative delay");
-        }
-
-        auto now = std::chrono::steady_clock::now();
-        auto time = now + delay;
-        if (delay > std::chrono::nanoseconds::zero() && time < now)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "delay too large, resulting in overflow");
-        }
-
-        bool inserted = _tasks.insert(make_pair(task, time)).second;
-        if (!inserted)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
-        }
-        _tokens.insert({ time, std::nullopt, task });
-
-        if(_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-        {
-            _condition.notify_one();
-        }
+        schedule(task, scheduledTime(delay), std::nullopt);
     }
 
     // Schedule a task for repeated execution with the given delay between each execution.
     template<class Rep, class Period>
     void scheduleRepeated(TimerTaskPtr task, const std::chrono::duration<Rep, Period>& delay)
     {
-        std::lock_guard lock(_mutex);
-        if (_destroyed)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
-        }
-
-        if (delay < std::chrono::nanoseconds::zero())
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "invalid negative delay");
-        }
-
-        auto now = std::chrono::steady_clock::now();
-        auto time = now + delay;
-        if (delay > std::chrono::nanoseconds::zero() && time < now)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "delay too large, resulting in overflow");
-        }
-
-        bool inserted = _tasks.insert(make_pair(task, time)).second;
-        if(!inserted)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
-        }
-        _tokens.insert({ time, std::chrono::duration_cast<std::chrono::nanoseconds>(delay), task });
-
-        if(_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-        {
-            _condition.notify_one();
-        }
+        schedule(task, scheduledTime(delay), std::chrono::duration_cast<std::chrono::nanoseconds>(delay));
     }
 
     //
@@ -127,6 +77,25 @@ protected:
 
 private:
 
+    template<class Rep, class Period>
+    static std::chrono::steady_clock::time_point scheduledTime(const std::chrono::duration<Rep, Period>& delay)
+    {
+        if (delay < std::chrono::nanoseconds::zero())
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "invalid negative delay");
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        auto time = now + delay;
+        if (delay > std::chrono::nanoseconds::zero() && time < now)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "delay too large, resulting in overflow");
+        }
+        return std::chrono::time_point_cast<std::chrono::steady_clock::duration>(time);
+    }
+
+    void schedule(const TimerTaskPtr&, std::chrono::steady_clock::time_point, std::optional<std::chrono::nanoseconds>);
+
     struct Token
     {
         std::chrono::steady_clock::time_point scheduledTime;
@@ -147,6 +116,11 @@ private:
     };
 
     void run();
+    void runWheel();
+    void runTask(const TimerTaskPtr&);
+
+    // The timing wheel, set if the timer was created with a non-zero resolution.
+    struct Wheel;
 
     std::mutex _mutex;
     std::condition_variable _condition;
@@ -154,6 +128,7 @@ private:
     std::map<TimerTaskPtr, std::chrono::steady_clock::time_point> _tasks;
     bool _destroyed;
     std::chrono::steady_clock::time_point _wakeUpTime;
+    std::unique_ptr<Wheel> _wheel;
     std::thread _worker;
 };
 
@@ -38,9 +38,9 @@ Glacier2::Blobject::Blobject(shared_ptr<Instance> instance, shared_ptr<Connectio
                         _instance->properties()->getPropertyAsInt(clientTraceOverride)),
     _context(context)
 {
-    auto t = _reverseConnection ? _instance->serverRequestQueueThread() : _instance->clientRequestQueueThread();
-    if(t)
+    if(_reverseConnection ? _instance->serverBuffered() : _instance->clientBuffered())
     {
+        auto t = _reverseConnection ? _instance->serverRequestQueueThread() : _instance->clientRequestQueueThread();
         const_cast<shared_ptr<RequestQueue>&>(_requestQueue) = make_shared<RequestQueue>(t,
                                                                                          _instance,
                                                                                          _reverseConnection);
@@ -67,8 +67,10 @@ Glacier2::Blobject::updateObserver(const shared_ptr<Glacier2::Instrumentation::S
 
 void
 Glacier2::Blobject::invoke(ObjectPrx& proxy,
+                           const std::pair<const Byte*, const Byte*>& request,
                            const std::pair<const Byte*, const Byte*>& inParams,
                            function<void(bool, const pair<const Byte*, const Byte*>&)> response,
+                           function<void(const pair<const Byte*, const Byte*>&)> reply,
                            function<void(exception_ptr)> exception,
                            const Current& current)
 {
@@ -195,6 +197,8 @@ Glacier2::Blobject::invoke(ObjectPrx& proxy,
         }
     }
 
+    const bool forward = forwardRequest(proxy, current);
+
     if(_requestQueue)
     {
         //
@@ -206,8 +210,10 @@ Glacier2::Blobject::invoke(ObjectPrx& proxy,
         bool override;
         try
         {
-            override = _requestQueue->addRequest(make_shared<Request>(proxy, inParams, current, _forwardContext,
-                                                                      _context, std::move(response), exception));
+            override = _requestQueue->addRequest(make_shared<Request>(proxy, request, inParams, current,
+                                                                      _forwardContext, _context, forward,
+                                                                      std::move(response), std::move(reply),
+                                                                      exception));
         }
         catch(const ObjectNotExistException&)
         {
@@ -267,7 +273,17 @@ Glacier2::Blobject::invoke(ObjectPrx& proxy,
                     };
             }
 
-            if(_forwardContext)
+            if(forward)
+            {
+                function<void(pair<const Byte*, const Byte*>)> amiReply = nullptr;
+                if(proxy->ice_isTwoway())
+                {
+                    amiReply = std::move(reply);
+                }
+                proxy->ice_forwardAsync(request, std::move(amiReply), std::move(exception), std::move(amiSent),
+                                        current);
+            }
+            else if(_forwardContext)
             {
                 if(_context.size() > 0)
                 {
@@ -302,3 +318,25 @@ Glacier2::Blobject::invoke(ObjectPrx& proxy,
         }
     }
 }
+
+bool
+Glacier2::Blobject::forwardRequest(const ObjectPrx& proxy, const Current& current) const
+{
+    //
+    // The encoded request is forwarded as is if the target receives the identity, facet and
+    // context of the request, otherwise the request is marshaled again with ice_invokeAsync.
+    //
+    if(!_context.empty() || proxy->ice_getIdentity() != current.id || proxy->ice_getFacet() != current.facet)
+    {
+        return false;
+    }
+    else if(_forwardContext)
+    {
+        return true;
+    }
+    else
+    {
+        return current.ctx.empty() && proxy->ice_getContext().empty() &&
+            !_instance->communicator()->getImplicitContext();
+    }
+}
@@ -12,7 +12,7 @@
 namespace Glacier2
 {
 
-class Blobject : public Ice::BlobjectArrayAsync, public std::enable_shared_from_this<Blobject>
+class Blobject : public Ice::BlobjectForwardAsync, public std::enable_shared_from_this<Blobject>
 {
 public:
 
@@ -27,8 +27,10 @@ public:
 protected:
 
     void invoke(Ice::ObjectPrx&,
+                const std::pair<const Ice::Byte*, const Ice::Byte*>&,
                 const std::pair<const Ice::Byte*, const Ice::Byte*>&,
                 std::function<void(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&)>,
+                std::function<void(const std::pair<const Ice::Byte*, const Ice::Byte*>&)>,
                 std::function<void(std::exception_ptr)>,
                 const Ice::Current&);
 
@@ -37,6 +39,8 @@ protected:
 
 private:
 
+    bool forwardRequest(const Ice::ObjectPrx&, const Ice::Current&) const;
+
     const bool _forwardContext;
     const int _requestTraceLevel;
     const int _overrideTraceLevel;
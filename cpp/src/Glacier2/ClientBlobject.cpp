@@ -24,8 +24,10 @@ Glacier2::ClientBlobject::ClientBlobject(shared_ptr<Instance>instance,
 }
 
 void
-Glacier2::ClientBlobject::ice_invokeAsync(pair<const Byte*, const Byte*> inParams,
+Glacier2::ClientBlobject::ice_invokeAsync(pair<const Byte*, const Byte*> request,
+                                          pair<const Byte*, const Byte*> inParams,
                                           function<void(bool, const pair<const Byte*, const Byte*>&)> response,
+                                          function<void(const pair<const Byte*, const Byte*>&)> reply,
                                           function<void(exception_ptr)> error,
                                           const Current& current)
 {
@@ -113,7 +115,7 @@ Glacier2::ClientBlobject::ice_invokeAsync(pair<const Byte*, const Byte*> inParam
         throw ObjectNotExistException(__FILE__, __LINE__, current.id, "", "");
     }
 
-    invoke(proxy.value(), inParams, std::move(response), std::move(error), current);
+    invoke(proxy.value(), request, inParams, std::move(response), std::move(reply), std::move(error), current);
 }
 
 shared_ptr<StringSet>
@@ -21,8 +21,10 @@ public:
     ClientBlobject(std::shared_ptr<Instance>, std::shared_ptr<FilterManager>, const Ice::Context&,
                    std::shared_ptr<RoutingTable>);
 
-    void ice_invokeAsync(std::pair<const Ice::Byte*, const Ice::Byte*> inEncaps,
+    void ice_invokeAsync(std::pair<const Ice::Byte*, const Ice::Byte*> request,
+                         std::pair<const Ice::Byte*, const Ice::Byte*> inEncaps,
                          std::function<void(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&)> response,
+                         std::function<void(const std::pair<const Ice::Byte*, const Ice::Byte*>&)> reply,
                          std::function<void(std::exception_ptr)> error,
                          const Ice::Current& current) override;
 
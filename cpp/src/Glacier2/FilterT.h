@@ -7,16 +7,18 @@
 #include <Glacier2/Session.h>
 
 #include <Ice/Identity.h>
+#include <Ice/HashUtil.h>
 
-#include <list>
+#include <algorithm>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace Glacier2
 {
 
-template <typename T, class P>
+template <typename T, class P, class H>
 class FilterT : public P
 {
 public:
@@ -36,127 +38,70 @@ public:
     bool
     match(const T& candidate) const
     {
-        std::lock_guard<std::mutex> lg(_mutex);
+        auto items = std::atomic_load(&_items);
         //
-        // Empty vectors mean no filtering, so all matches will succeed.
+        // Empty sets mean no filtering, so all matches will succeed.
         //
-        if(_items.size() == 0)
-        {
-            return true;
-        }
-
-        return binary_search(_items.begin(), _items.end(), candidate);
+        return items->empty() || items->find(candidate) != items->end();
     }
 
     bool
     empty() const
     {
-        std::lock_guard<std::mutex> lg(_mutex);
-        return _items.size() == 0;
+        return std::atomic_load(&_items)->empty();
     }
 
 private:
 
-    std::vector<T> _items;
+    using Items = std::unordered_set<T, H>;
 
-    mutable std::mutex _mutex;
+    //
+    // An immutable set of the filter items, replaced each time the filter is
+    // updated. Requests load it atomically instead of locking _mutex.
+    //
+    std::shared_ptr<const Items> _items;
+
+    std::mutex _mutex; // Serializes updates.
 };
 
-template<class T, class P>
-FilterT<T, P>::FilterT(const std::vector<T>& accept):
-    _items(accept)
+template<class T, class P, class H>
+FilterT<T, P, H>::FilterT(const std::vector<T>& accept):
+    _items(std::make_shared<const Items>(accept.begin(), accept.end()))
 {
-    sort(_items.begin(), _items.end());
-    _items.erase(unique(_items.begin(), _items.end()), _items.end());
 }
 
-template<class T, class P> void
-FilterT<T, P>::add(std::vector<T> additions, const Ice::Current&)
+template<class T, class P, class H> void
+FilterT<T, P, H>::add(std::vector<T> additions, const Ice::Current&)
 {
-    //
-    // Sort the filter elements first, erasing duplicates. Then we can
-    // simply use the STL merge algorithm to add to our list of filters.
-    //
-    std::vector<T> newItems(additions);
-    sort(newItems.begin(), newItems.end());
-    newItems.erase(unique(newItems.begin(), newItems.end()), newItems.end());
-
     std::lock_guard<std::mutex> lg(_mutex);
-    std::vector<T> merged(_items.size() + newItems.size());
-    merge(newItems.begin(), newItems.end(), _items.begin(), _items.end(), merged.begin());
-    merged.erase(unique(merged.begin(), merged.end()), merged.end());
-    swap(_items, merged);
+    auto items = std::make_shared<Items>(*_items);
+    items->insert(additions.begin(), additions.end());
+    std::atomic_store(&_items, std::shared_ptr<const Items>(std::move(items)));
 }
 
-template<class T, class P> void
-FilterT<T, P>::remove(std::vector<T> deletions, const Ice::Current&)
+template<class T, class P, class H> void
+FilterT<T, P, H>::remove(std::vector<T> deletions, const Ice::Current&)
 {
-    //
-    // Our removal algorithm depends on the filter elements to be
-    // removed to be sorted in the same order as our current elements.
-    //
-    std::vector<T> toRemove(deletions);
-    sort(toRemove.begin(), toRemove.end());
-    toRemove.erase(unique(toRemove.begin(), toRemove.end()), toRemove.end());
-
     std::lock_guard<std::mutex> lg(_mutex);
-
-    //
-    // Our vectors are both sorted, so if we keep track of our first
-    // match between the current set and the set of items to be removed,
-    // we do not need to traverse the whole of the current set each
-    // time. We also use a list of deletions instead of erasing things
-    // itemwise.
-    //
-
-    typename std::vector<T>::const_iterator r = toRemove.begin();
-    typename std::vector<T>::iterator mark = _items.begin();
-    std::list<typename std::vector<T>::iterator> deleteList;
-
-    while(r != toRemove.end())
+    auto items = std::make_shared<Items>(*_items);
+    for(const auto& item : deletions)
     {
-        typename std::vector<T>::iterator i = mark;
-        while(i != _items.end() && r != toRemove.end())
-        {
-            if(*r == *i)
-            {
-                //
-                // We want this list to be in LIFO order because we are
-                // going to erase things from the tail forward.
-                //
-                deleteList.push_front(i);
-                ++i;
-                ++r;
-                mark = i;
-            }
-            else
-            {
-                ++i;
-            }
-        }
-
-        if(r == toRemove.end())
-        {
-            break;
-        }
-        ++r;
-    }
-
-    for(const auto& item : deleteList)
-    {
-        _items.erase(item);
+        items->erase(item);
     }
+    std::atomic_store(&_items, std::shared_ptr<const Items>(std::move(items)));
 }
 
-template<class T, class P> std::vector<T>
-FilterT<T, P>::get(const Ice::Current&)
+template<class T, class P, class H> std::vector<T>
+FilterT<T, P, H>::get(const Ice::Current&)
 {
-    std::lock_guard<std::mutex> lg(_mutex);
-    return _items;
+    auto items = std::atomic_load(&_items);
+    std::vector<T> result(items->begin(), items->end());
+    std::sort(result.begin(), result.end());
+    return result;
 }
 
-using IdentitySetI = FilterT<Ice::Identity, Glacier2::IdentitySet>;
-using StringSetI = FilterT<std::string, Glacier2::StringSet>;
+using IdentitySetI = FilterT<Ice::Identity, Glacier2::IdentitySet, IceInternal::IdentityHash>;
+using StringSetI = FilterT<std::string, Glacier2::StringSet, std::hash<std::string>>;
 
 }
 
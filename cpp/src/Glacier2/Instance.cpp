@@ -15,8 +15,27 @@ namespace
 
 const string serverSleepTime = "Glacier2.Server.SleepTime";
 const string clientSleepTime = "Glacier2.Client.SleepTime";
-const string serverBuffered = "Glacier2.Server.Buffered";
-const string clientBuffered = "Glacier2.Client.Buffered";
+const string serverBufferedProperty = "Glacier2.Server.Buffered";
+const string clientBufferedProperty = "Glacier2.Client.Buffered";
+const string serverRequestQueueThreads = "Glacier2.Server.RequestQueueThreads";
+const string clientRequestQueueThreads = "Glacier2.Client.RequestQueueThreads";
+
+vector<shared_ptr<RequestQueueThread>>
+createRequestQueueThreads(const shared_ptr<Ice::Properties>& properties, const string& buffered,
+                          const string& sleepTime, const string& threads)
+{
+    vector<shared_ptr<RequestQueueThread>> requestQueueThreads;
+    if(properties->getPropertyAsIntWithDefault(buffered, 0) > 0)
+    {
+        auto time = chrono::milliseconds(properties->getPropertyAsInt(sleepTime));
+        auto size = max(properties->getPropertyAsIntWithDefault(threads, 1), 1);
+        for(int i = 0; i < size; ++i)
+        {
+            requestQueueThreads.push_back(make_shared<RequestQueueThread>(time));
+        }
+    }
+    return requestQueueThreads;
+}
 
 }
 
@@ -27,20 +46,14 @@ Glacier2::Instance::Instance(shared_ptr<Ice::Communicator> communicator, shared_
     _logger(_communicator->getLogger()),
     _clientAdapter(std::move(clientAdapter)),
     _serverAdapter(std::move(serverAdapter)),
+    _clientRequestQueueThreads(createRequestQueueThreads(_properties, clientBufferedProperty, clientSleepTime,
+                                                         clientRequestQueueThreads)),
+    _serverRequestQueueThreads(createRequestQueueThreads(_properties, serverBufferedProperty, serverSleepTime,
+                                                         serverRequestQueueThreads)),
+    _nextClientRequestQueueThread(0),
+    _nextServerRequestQueueThread(0),
     _proxyVerifier(make_shared<ProxyVerifier>(_communicator))
 {
-    if(_properties->getPropertyAsIntWithDefault(serverBuffered, 0) > 0)
-    {
-        auto sleepTime = chrono::milliseconds(_properties->getPropertyAsInt(serverSleepTime));
-        const_cast<shared_ptr<RequestQueueThread>&>(_serverRequestQueueThread) = make_shared<RequestQueueThread>(sleepTime);
-    }
-
-    if(_properties->getPropertyAsIntWithDefault(clientBuffered, 0) > 0)
-    {
-        auto sleepTime = chrono::milliseconds(_properties->getPropertyAsInt(clientSleepTime));
-        const_cast<shared_ptr<RequestQueueThread>&>(_clientRequestQueueThread) = make_shared<RequestQueueThread>(sleepTime);
-    }
-
     //
     // If an Ice metrics observer is setup on the communicator, also enable metrics for Glacier2.
     //
@@ -56,19 +69,33 @@ Glacier2::Instance::Instance(shared_ptr<Ice::Communicator> communicator, shared_
 void
 Glacier2::Instance::destroy()
 {
-    if(_clientRequestQueueThread)
+    for(const auto& thread : _clientRequestQueueThreads)
     {
-        _clientRequestQueueThread->destroy();
+        thread->destroy();
     }
 
-    if(_serverRequestQueueThread)
+    for(const auto& thread : _serverRequestQueueThreads)
     {
-        _serverRequestQueueThread->destroy();
+        thread->destroy();
     }
 
     _sessionRouter = nullptr;
 }
 
+shared_ptr<RequestQueueThread>
+Glacier2::Instance::clientRequestQueueThread()
+{
+    assert(!_clientRequestQueueThreads.empty());
+    return _clientRequestQueueThreads[_nextClientRequestQueueThread++ % _clientRequestQueueThreads.size()];
+}
+
+shared_ptr<RequestQueueThread>
+Glacier2::Instance::serverRequestQueueThread()
+{
+    assert(!_serverRequestQueueThreads.empty());
+    return _serverRequestQueueThreads[_nextServerRequestQueueThread++ % _serverRequestQueueThreads.size()];
+}
+
 void
 Glacier2::Instance::setSessionRouter(shared_ptr<SessionRouterI> sessionRouter)
 {
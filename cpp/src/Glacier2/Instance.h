@@ -14,6 +14,8 @@
 #include <Glacier2/SessionRouterI.h>
 #include <Glacier2/Instrumentation.h>
 
+#include <atomic>
+
 namespace Glacier2
 {
 
@@ -30,8 +32,15 @@ public:
     std::shared_ptr<Ice::Properties> properties() const { return _properties; }
     std::shared_ptr<Ice::Logger> logger() const { return _logger; }
 
-    std::shared_ptr<RequestQueueThread> clientRequestQueueThread() const { return _clientRequestQueueThread; }
-    std::shared_ptr<RequestQueueThread> serverRequestQueueThread() const { return _serverRequestQueueThread; }
+    bool clientBuffered() const { return !_clientRequestQueueThreads.empty(); }
+    bool serverBuffered() const { return !_serverRequestQueueThreads.empty(); }
+
+    //
+    // Return the request queue thread for a new session. The sessions are
+    // spread across the request queue threads in turn.
+    //
+    std::shared_ptr<RequestQueueThread> clientRequestQueueThread();
+    std::shared_ptr<RequestQueueThread> serverRequestQueueThread();
     std::shared_ptr<ProxyVerifier> proxyVerifier() const { return _proxyVerifier; }
     std::shared_ptr<SessionRouterI> sessionRouter() const { return _sessionRouter; }
 
@@ -48,8 +57,10 @@ private:
     const std::shared_ptr<Ice::Logger> _logger;
     const std::shared_ptr<Ice::ObjectAdapter> _clientAdapter;
     const std::shared_ptr<Ice::ObjectAdapter> _serverAdapter;
-    const std::shared_ptr<RequestQueueThread> _clientRequestQueueThread;
-    const std::shared_ptr<RequestQueueThread> _serverRequestQueueThread;
+    const std::vector<std::shared_ptr<RequestQueueThread>> _clientRequestQueueThreads;
+    const std::vector<std::shared_ptr<RequestQueueThread>> _serverRequestQueueThreads;
+    std::atomic<size_t> _nextClientRequestQueueThread;
+    std::atomic<size_t> _nextServerRequestQueueThread;
     const std::shared_ptr<ProxyVerifier> _proxyVerifier;
     std::shared_ptr<SessionRouterI> _sessionRouter;
     const std::shared_ptr<Glacier2::Instrumentation::RouterObserver> _observer;
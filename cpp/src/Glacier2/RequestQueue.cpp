@@ -10,16 +10,21 @@ using namespace std;
 using namespace Ice;
 using namespace Glacier2;
 
-Glacier2::Request::Request(ObjectPrxPtr proxy, const std::pair<const Byte*, const Byte*>& inParams,
-                 const Current& current, bool forwardContext, const Ice::Context& sslContext,
+Glacier2::Request::Request(ObjectPrxPtr proxy, const std::pair<const Byte*, const Byte*>& request,
+                 const std::pair<const Byte*, const Byte*>& inParams,
+                 const Current& current, bool forwardContext, const Ice::Context& sslContext, bool forward,
                  function<void(bool, pair<const Byte*, const Byte*>)> response,
+                 function<void(const pair<const Byte*, const Byte*>&)> reply,
                  function<void(exception_ptr)> exception) :
     _proxy(std::move(proxy)),
-    _inParams(inParams.first, inParams.second),
+    _request(forward ? ByteSeq(request.first, request.second) : ByteSeq()),
+    _inParams(forward ? ByteSeq() : ByteSeq(inParams.first, inParams.second)),
     _current(current),
     _forwardContext(forwardContext),
     _sslContext(sslContext),
+    _forward(forward),
     _response(std::move(response)),
+    _reply(std::move(reply)),
     _exception(std::move(exception))
 {
     Context::const_iterator p = current.ctx.find("_ovrd");
@@ -34,6 +39,18 @@ Glacier2::Request::invoke(function<void(bool, pair<const Byte*, const Byte*>)>&&
                           function<void(exception_ptr)>&& exception,
                           std::function<void(bool)>&& sent)
 {
+    if(_forward)
+    {
+        function<void(pair<const Byte*, const Byte*>)> reply = nullptr;
+        if(_proxy->ice_isTwoway())
+        {
+            reply = _reply;
+        }
+        _proxy->ice_forwardAsync({ _request.data(), _request.data() + _request.size() }, std::move(reply),
+                                 std::move(exception), std::move(sent), _current);
+        return;
+    }
+
     pair<const Byte*, const Byte*> inPair;
     if(_inParams.size() == 0)
     {
@@ -194,17 +211,18 @@ Glacier2::RequestQueue::addRequest(shared_ptr<Request> request)
     return false;
 }
 
-void
-Glacier2::RequestQueue::flushRequests()
+size_t
+Glacier2::RequestQueue::flushRequests(chrono::steady_clock::time_point now)
 {
     lock_guard<mutex> lg(_mutex);
+    _lastFlush = now;
     if(_connection)
     {
         if(_pendingSend)
         {
-            return;
+            return 0;
         }
-        flush();
+        return flush();
     }
     else
     {
@@ -226,10 +244,18 @@ Glacier2::RequestQueue::flushRequests()
                 }
             );
         }
+        size_t count = _requests.size();
         _requests.clear();
+        return count;
     }
 }
 
+chrono::steady_clock::time_point
+Glacier2::RequestQueue::lastFlush() const
+{
+    return _lastFlush;
+}
+
 void
 Glacier2::RequestQueue::destroy()
 {
@@ -244,7 +270,7 @@ Glacier2::RequestQueue::updateObserver(shared_ptr<Glacier2::Instrumentation::Ses
     _observer = observer;
 }
 
-void
+size_t
 Glacier2::RequestQueue::flush()
 {
     assert(_connection);
@@ -291,6 +317,7 @@ Glacier2::RequestQueue::flush()
         }
     }
 
+    size_t count = static_cast<size_t>(p - _requests.begin());
     if(p == _requests.end())
     {
         _requests.clear();
@@ -299,6 +326,7 @@ Glacier2::RequestQueue::flush()
     {
         _requests.erase(_requests.begin(), p);
     }
+    return count;
 }
 
 void
@@ -342,7 +370,6 @@ Glacier2::RequestQueue::sent(bool sentSynchronously, const shared_ptr<Request>&
 Glacier2::RequestQueueThread::RequestQueueThread(std::chrono::milliseconds sleepTime) :
     _sleepTime(std::move(sleepTime)),
     _destroy(false),
-    _sleep(false),
     _thread([this] { run(); })
 {
 }
@@ -360,7 +387,6 @@ Glacier2::RequestQueueThread::destroy()
         lock_guard<mutex> lg(_mutex);
         assert(!_destroy);
         _destroy = true;
-        _sleep = false;
     }
 
     _condVar.notify_one();
@@ -378,7 +404,11 @@ Glacier2::RequestQueueThread::flushRequestQueue(shared_ptr<RequestQueue> queue)
         throw Ice::ObjectNotExistException(__FILE__, __LINE__);
     }
 
-    if(_queues.empty() && !_sleep)
+    //
+    // With a sleep time, the thread might be waiting for the sleep time of
+    // another queue to elapse, it's notified to flush this queue if it's idle.
+    //
+    if(_queues.empty() || _sleepTime > 0ms)
     {
         _condVar.notify_one();
     }
@@ -388,8 +418,6 @@ Glacier2::RequestQueueThread::flushRequestQueue(shared_ptr<RequestQueue> queue)
 void
 Glacier2::RequestQueueThread::run()
 {
-    std::chrono::nanoseconds sleepDuration = 0ns;
-
     while(true)
     {
         vector<shared_ptr<RequestQueue>> queues;
@@ -403,26 +431,40 @@ Glacier2::RequestQueueThread::run()
             // wait until all the responses for twoway requests are
             // received.
             //
-            while(!_destroy && (_queues.empty() || _sleep))
+            while(!_destroy)
             {
-                if(_sleep)
+                auto now = chrono::steady_clock::now();
+                auto wakeTime = _nextFlush;
+                if(now >= _nextFlush && !_queues.empty())
                 {
-                    auto now = chrono::steady_clock::now();
-
-                    if(_condVar.wait_for(lock, sleepDuration) == cv_status::no_timeout)
-                    {
-                        sleepDuration = 0ns;
-                    }
-                    else
+                    //
+                    // Take the queues of idle sessions, that is the queues which weren't
+                    // flushed within the sleep time. The other queues wait for the rest of
+                    // their sleep time, so that their requests can override each other.
+                    //
+                    auto p = stable_partition(_queues.begin(), _queues.end(),
+                                              [this, now](const shared_ptr<RequestQueue>& queue)
+                                              {
+                                                  return queue->lastFlush() + _sleepTime > now;
+                                              });
+                    queues.assign(make_move_iterator(p), make_move_iterator(_queues.end()));
+                    _queues.erase(p, _queues.end());
+                    if(!queues.empty())
                     {
-                        sleepDuration -= chrono::steady_clock::now() - now;
+                        break;
                     }
 
-                    if(sleepDuration <= 0ns)
+                    wakeTime = chrono::steady_clock::time_point::max();
+                    for(const auto& queue : _queues)
                     {
-                        _sleep = false;
+                        wakeTime = min(wakeTime, queue->lastFlush() + _sleepTime);
                     }
                 }
+
+                if(now < wakeTime && wakeTime != chrono::steady_clock::time_point::max())
+                {
+                    _condVar.wait_until(lock, wakeTime);
+                }
                 else
                 {
                     _condVar.wait(lock);
@@ -430,28 +472,43 @@ Glacier2::RequestQueueThread::run()
             }
 
             //
-            // If the queue is being destroyed and there's no requests or responses
-            // to send, we're done.
+            // If the queue is being destroyed, flush the remaining queues
+            // right away. If there's no requests or responses to send,
+            // we're done.
             //
-            if(_destroy && _queues.empty())
+            if(_destroy)
             {
-                return;
-            }
-
-            assert(!_queues.empty() && !_sleep);
-
-            queues.swap(_queues);
-
-            if(_sleepTime > 0ms)
-            {
-                _sleep = true;
-                sleepDuration = _sleepTime;
+                if(_queues.empty())
+                {
+                    return;
+                }
+                queues.insert(queues.end(), make_move_iterator(_queues.begin()), make_move_iterator(_queues.end()));
+                _queues.clear();
             }
         }
 
+        auto start = chrono::steady_clock::now();
+        size_t requests = 0;
         for(const auto& queue : queues)
         {
-            queue->flushRequests();
+            requests += queue->flushRequests(start);
+        }
+        auto flushTime = chrono::steady_clock::now() - start;
+
+        //
+        // Without a sleep time, the wait adapts to the load: if the flush only
+        // forwarded a single request and no queue was added meanwhile, the thread
+        // is idle and the next queue is flushed immediately. Otherwise, there's a
+        // backlog and the thread waits for as long as the flush took to batch
+        // more requests with the next flush.
+        //
+        if(_sleepTime == 0ms)
+        {
+            lock_guard<mutex> lg(_mutex);
+            if(requests > 1 || !_queues.empty())
+            {
+                _nextFlush = chrono::steady_clock::now() + flushTime;
+            }
         }
     }
 }
@@ -24,11 +24,14 @@ class Request
 public:
 
     Request(Ice::ObjectPrxPtr,
+            const std::pair<const Ice::Byte*, const Ice::Byte*>&,
             const std::pair<const Ice::Byte*, const Ice::Byte*>&,
             const Ice::Current&,
             bool,
             const Ice::Context&,
+            bool,
             std::function<void(bool, std::pair<const Ice::Byte*, const Ice::Byte*>)>,
+            std::function<void(const std::pair<const Ice::Byte*, const Ice::Byte*>&)>,
             std::function<void(std::exception_ptr)>);
 
     void invoke(std::function<void(bool, std::pair<const Ice::Byte*, const Ice::Byte*>)>&&,
@@ -45,12 +48,15 @@ private:
     void queued();
 
     const Ice::ObjectPrxPtr _proxy;
-    const Ice::ByteSeq _inParams;
+    const Ice::ByteSeq _request; // The encoded request if it's forwarded with ice_forwardAsync.
+    const Ice::ByteSeq _inParams; // The in-parameters otherwise.
     const Ice::Current _current;
     const bool _forwardContext;
     const Ice::Context _sslContext;
+    const bool _forward;
     const std::string _override;
     std::function<void(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&)> _response;
+    std::function<void(const std::pair<const Ice::Byte*, const Ice::Byte*>&)> _reply;
     std::function<void(std::exception_ptr)> _exception;
 };
 
@@ -61,7 +67,8 @@ public:
     RequestQueue(std::shared_ptr<RequestQueueThread>, std::shared_ptr<Instance>, std::shared_ptr<Ice::Connection>);
 
     bool addRequest(std::shared_ptr<Request>);
-    void flushRequests();
+    size_t flushRequests(std::chrono::steady_clock::time_point);
+    std::chrono::steady_clock::time_point lastFlush() const;
 
     void destroy();
 
@@ -69,7 +76,7 @@ public:
 
 private:
 
-    void flush();
+    size_t flush();
 
     void response(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&, const std::shared_ptr<Request>&);
     void exception(std::exception_ptr, const std::shared_ptr<Request>&);
@@ -85,6 +92,9 @@ private:
     bool _destroyed;
     std::shared_ptr<Glacier2::Instrumentation::SessionObserver> _observer;
 
+    // Only used by the request queue thread.
+    std::chrono::steady_clock::time_point _lastFlush;
+
     std::mutex _mutex;
 };
 
@@ -103,7 +113,7 @@ private:
 
     const std::chrono::milliseconds _sleepTime;
     bool _destroy;
-    bool _sleep;
+    std::chrono::steady_clock::time_point _nextFlush;
 
     std::vector<std::shared_ptr<RequestQueue>> _queues;
 
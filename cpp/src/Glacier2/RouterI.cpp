@@ -20,8 +20,8 @@ Glacier2::RouterI::RouterI(shared_ptr<Instance> instance, shared_ptr<Connection>
     _instance(std::move(instance)),
     _routingTable(make_shared<RoutingTable>(_instance->communicator(), _instance->proxyVerifier())),
     _clientBlobject(make_shared<ClientBlobject>(_instance, std::move(filters), context, _routingTable)),
-    _clientBlobjectBuffered(_instance->clientRequestQueueThread()),
-    _serverBlobjectBuffered(_instance->serverRequestQueueThread()),
+    _clientBlobjectBuffered(_instance->clientBuffered()),
+    _serverBlobjectBuffered(_instance->serverBuffered()),
     _connection(std::move(connection)),
     _userId(userId),
     _session(std::move(session)),
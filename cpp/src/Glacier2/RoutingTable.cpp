@@ -13,7 +13,8 @@ Glacier2::RoutingTable::RoutingTable(shared_ptr<Communicator> communicator, shar
     _communicator(std::move(communicator)),
     _traceLevel(_communicator->getProperties()->getPropertyAsInt("Glacier2.Trace.RoutingTable")),
     _maxSize(_communicator->getProperties()->getPropertyAsIntWithDefault("Glacier2.RoutingTable.MaxSize", 1000)),
-    _verifier(std::move(verifier))
+    _verifier(std::move(verifier)),
+    _clock(0)
 {
 }
 
@@ -23,7 +24,7 @@ Glacier2::RoutingTable::destroy()
     lock_guard<mutex> lg(_mutex);
     if(_observer)
     {
-        _observer->routingTableSize(-static_cast<int>(_map.size()));
+        _observer->routingTableSize(-static_cast<int>(_queue.size()));
     }
     _observer.detach();
 }
@@ -34,7 +35,8 @@ Glacier2::RoutingTable::updateObserver(const shared_ptr<Glacier2::Instrumentatio
                                        const shared_ptr<Ice::Connection>& connection)
 {
     lock_guard<mutex> lg(_mutex);
-    _observer.attach(obsv->getSessionObserver(userId, connection, static_cast<int>(_map.size()), _observer.get()));
+    _observer.attach(obsv->getSessionObserver(userId, connection, static_cast<int>(_queue.size()),
+                                             _observer.get()));
     return _observer.get();
 }
 
@@ -43,7 +45,7 @@ Glacier2::RoutingTable::add(const ObjectProxySeq& unfiltered, const Current& cur
 {
     lock_guard<mutex> lg(_mutex);
 
-    size_t sz = _map.size();
+    size_t sz = _queue.size();
 
     //
     // We 'pre-scan' the list, applying our validation rules. The
@@ -70,56 +72,72 @@ Glacier2::RoutingTable::add(const ObjectProxySeq& unfiltered, const Current& cur
     ObjectProxySeq evictedProxies;
     for(const auto& proxy : proxies)
     {
-        EvictorMap::iterator p = _map.find(proxy->ice_getIdentity());
-
-        if(p == _map.end())
+        const Identity ident = proxy->ice_getIdentity();
+        EvictorShard& s = shard(ident);
         {
-            if(_traceLevel == 1 || _traceLevel >= 3)
+            lock_guard<mutex> shardLock(s.mutex);
+            EvictorMap::iterator p = s.map.find(ident);
+            if(p == s.map.end())
             {
-                Trace out(_communicator->getLogger(), "Glacier2");
-                out << "adding proxy to routing table:\n" << proxy;
+                if(_traceLevel == 1 || _traceLevel >= 3)
+                {
+                    Trace out(_communicator->getLogger(), "Glacier2");
+                    out << "adding proxy to routing table:\n" << proxy;
+                }
+
+                auto entry = make_shared<EvictorEntry>();
+                entry->proxy = proxy;
+                entry->lastUse = ++_clock;
+                s.map.insert({ ident, entry });
+                _queue.insert({ entry->lastUse.load(), entry });
             }
-
-            auto entry = make_shared<EvictorEntry>();
-            p = _map.insert(_map.begin(), {proxy->ice_getIdentity(), entry});
-            EvictorQueue::iterator q = _queue.insert(_queue.end(), p);
-            entry->proxy = proxy;
-            entry->pos = q;
-        }
-        else
-        {
-            if(_traceLevel == 1 || _traceLevel >= 3)
+            else
             {
-                Trace out(_communicator->getLogger(), "Glacier2");
-                out << "proxy already in routing table:\n" << proxy;
-            }
+                if(_traceLevel == 1 || _traceLevel >= 3)
+                {
+                    Trace out(_communicator->getLogger(), "Glacier2");
+                    out << "proxy already in routing table:\n" << proxy;
+                }
 
-            auto entry = p->second;
-            _queue.erase(entry->pos);
-            EvictorQueue::iterator q = _queue.insert(_queue.end(), p);
-            entry->pos = q;
+                p->second->lastUse = ++_clock;
+            }
         }
 
-        while(static_cast<int>(_map.size()) > _maxSize)
+        while(static_cast<int>(_queue.size()) > _maxSize)
         {
-            p = _queue.front();
+            //
+            // The entry at the front of the queue is the least recently used if it wasn't used
+            // since it was queued. Otherwise, queue it again with its last time of use.
+            //
+            auto entry = _queue.begin()->second;
+            auto lastUse = entry->lastUse.load();
+            if(lastUse != _queue.begin()->first)
+            {
+                _queue.erase(_queue.begin());
+                _queue.insert({ lastUse, entry });
+                continue;
+            }
 
             if(_traceLevel >= 2)
             {
                 Trace out(_communicator->getLogger(), "Glacier2");
-                out << "evicting proxy from routing table:\n" << p->second->proxy;
+                out << "evicting proxy from routing table:\n" << entry->proxy;
             }
 
-            evictedProxies.push_back(p->second->proxy);
+            evictedProxies.push_back(entry->proxy);
 
-            _map.erase(p);
-            _queue.pop_front();
+            EvictorShard& evictShard = shard(entry->proxy->ice_getIdentity());
+            {
+                lock_guard<mutex> shardLock(evictShard.mutex);
+                evictShard.map.erase(entry->proxy->ice_getIdentity());
+            }
+            _queue.erase(_queue.begin());
         }
     }
 
     if(_observer)
     {
-        _observer->routingTableSize(static_cast<int>(_map.size()) - static_cast<int>(sz));
+        _observer->routingTableSize(static_cast<int>(_queue.size()) - static_cast<int>(sz));
     }
 
     return evictedProxies;
@@ -133,21 +151,24 @@ Glacier2::RoutingTable::get(const Identity& ident)
         return nullopt;
     }
 
-    lock_guard<mutex> lg(_mutex);
+    EvictorShard& s = shard(ident);
+    lock_guard<mutex> lg(s.mutex);
 
-    EvictorMap::iterator p = _map.find(ident);
+    EvictorMap::iterator p = s.map.find(ident);
 
-    if(p == _map.end())
+    if(p == s.map.end())
     {
         return nullopt;
     }
     else
     {
-        auto entry = p->second;
-        _queue.erase(entry->pos);
-        EvictorQueue::iterator q = _queue.insert(_queue.end(), p);
-        entry->pos = q;
-
-        return entry->proxy;
+        p->second->lastUse = ++_clock;
+        return p->second->proxy;
     }
 }
+
+Glacier2::RoutingTable::EvictorShard&
+Glacier2::RoutingTable::shard(const Identity& ident)
+{
+    return _shards[IceInternal::IdentityHash()(ident) % _shards.size()];
+}
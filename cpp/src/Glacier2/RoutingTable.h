@@ -7,12 +7,15 @@
 
 #include <Ice/Ice.h>
 #include <Ice/ObserverHelper.h>
+#include <Ice/HashUtil.h>
 
 #include <Glacier2/ProxyVerifier.h>
 #include <Glacier2/Instrumentation.h>
 
-#include <list>
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <unordered_map>
 
 namespace Glacier2
 {
@@ -40,23 +43,34 @@ private:
     const int _maxSize;
     const std::shared_ptr<ProxyVerifier> _verifier;
 
-    struct EvictorEntry;
-    using EvictorMap = std::map<Ice::Identity, std::shared_ptr<EvictorEntry>>;
-    using EvictorQueue = std::list<EvictorMap::iterator>;
-
-    friend struct EvictorEntry;
+    //
+    // The entries are partitioned by identity hash into shards, each with its own mutex, so
+    // that lookups for different identities don't contend. A lookup only records the time
+    // of use in the entry. The eviction queue orders the entries by their time of use when
+    // they were queued, entries used since are queued again when they reach the front.
+    //
     struct EvictorEntry
     {
         Ice::ObjectPrxPtr proxy;
-        EvictorQueue::iterator pos;
+        std::atomic<std::uint64_t> lastUse;
+    };
+    using EvictorMap = std::unordered_map<Ice::Identity, std::shared_ptr<EvictorEntry>, IceInternal::IdentityHash>;
+    using EvictorQueue = std::map<std::uint64_t, std::shared_ptr<EvictorEntry>>;
+
+    struct EvictorShard
+    {
+        std::mutex mutex;
+        EvictorMap map;
     };
+    EvictorShard& shard(const Ice::Identity&);
 
-    EvictorMap _map;
+    std::array<EvictorShard, 8> _shards;
+    std::atomic<std::uint64_t> _clock;
     EvictorQueue _queue;
 
     IceInternal::ObserverHelperT<Glacier2::Instrumentation::SessionObserver> _observer;
 
-    std::mutex _mutex;
+    std::mutex _mutex; // Protects the eviction queue and the observer.
 };
 
 }
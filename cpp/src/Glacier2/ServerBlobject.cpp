@@ -14,11 +14,13 @@ Glacier2::ServerBlobject::ServerBlobject(shared_ptr<Instance> instance, shared_p
 }
 
 void
-Glacier2::ServerBlobject::ice_invokeAsync(pair<const Byte*, const Byte*> inParams,
+Glacier2::ServerBlobject::ice_invokeAsync(pair<const Byte*, const Byte*> request,
+                                          pair<const Byte*, const Byte*> inParams,
                                           function<void(bool, const pair<const Byte*, const Byte*>&)> response,
+                                          function<void(const pair<const Byte*, const Byte*>&)> reply,
                                           function<void(exception_ptr)> error,
                                           const Current& current)
 {
     auto proxy = _reverseConnection->createProxy(current.id);
-    invoke(proxy, inParams, std::move(response), std::move(error), current);
+    invoke(proxy, request, inParams, std::move(response), std::move(reply), std::move(error), current);
 }
@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Buffer.h>
+#include <Ice/BufferPool.h>
 #include <Ice/LocalException.h>
 
 using namespace std;
@@ -83,7 +84,7 @@ IceInternal::Buffer::Container::~Container()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        BufferPool::deallocate(_buf, _capacity);
     }
 }
 
@@ -102,7 +103,7 @@ IceInternal::Buffer::Container::clear()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        BufferPool::deallocate(_buf, _capacity);
     }
 
     _buf = 0;
@@ -133,11 +134,11 @@ IceInternal::Buffer::Container::reserve(size_type n)
     pointer p;
     if(_owned)
     {
-        p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
+        p = BufferPool::reallocate(_buf, c, _size, _capacity);
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        p = BufferPool::allocate(_capacity);
         if(p)
         {
             ::memcpy(p, _buf, _size);
@@ -0,0 +1,410 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/BufferPool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Size classes are powers of two from 256 bytes (Buffer::Container never
+// allocates less than 240 bytes) to 16MB.
+//
+const size_t sizeClassMin = 256;
+const size_t sizeClassCount = 17;
+const size_t sizeClassMax = sizeClassMin << (sizeClassCount - 1);
+
+//
+// The per-thread statistics are added to the process statistics every
+// statsFlushInterval allocations to avoid contention on the counters.
+//
+const int statsFlushInterval = 256;
+
+//
+// The pool configuration, set once by configure(). These variables and the
+// flags below have constant initialization and trivial destructors, they can
+// be used by buffers released during the static destruction.
+//
+atomic<size_t> poolSizeMax(0);
+atomic<size_t> poolThreadCacheMax(0);
+atomic<size_t> poolCacheSizeMax(0);
+atomic<bool> poolConfigured(false);
+
+atomic<int64_t> poolAllocations(0);
+atomic<int64_t> poolHits(0);
+atomic<int64_t> poolCachedBytes(0);
+
+atomic<bool> sharedCacheDestroyed(false);
+thread_local bool threadCacheDestroyed = false;
+
+inline size_t
+sizeClass(size_t n)
+{
+    size_t k = 0;
+    for(size_t sz = sizeClassMin; sz < n; sz <<= 1)
+    {
+        ++k;
+    }
+    return k;
+}
+
+inline size_t
+classSize(size_t k)
+{
+    return sizeClassMin << k;
+}
+
+inline bool
+isClassSize(size_t n)
+{
+    return n >= sizeClassMin && n <= sizeClassMax && (n & (n - 1)) == 0;
+}
+
+class SharedCache
+{
+public:
+
+    SharedCache() :
+        _size(0)
+    {
+    }
+
+    ~SharedCache()
+    {
+        sharedCacheDestroyed = true;
+        for(size_t k = 0; k < sizeClassCount; ++k)
+        {
+            for(vector<Byte*>::const_iterator p = _blocks[k].begin(); p != _blocks[k].end(); ++p)
+            {
+                ::free(*p);
+            }
+        }
+    }
+
+    //
+    // Move up to n blocks of the given size class to the given vector.
+    //
+    void get(size_t k, vector<Byte*>& blocks, size_t n)
+    {
+        lock_guard lock(_mutex);
+        vector<Byte*>& cached = _blocks[k];
+        while(n-- > 0 && !cached.empty())
+        {
+            blocks.push_back(cached.back());
+            cached.pop_back();
+            _size -= classSize(k);
+        }
+    }
+
+    //
+    // Move blocks from the given vector to the shared cache, the blocks which
+    // don't fit in the cache are left in the vector.
+    //
+    void put(size_t k, vector<Byte*>& blocks, size_t n)
+    {
+        lock_guard lock(_mutex);
+        size_t max = poolCacheSizeMax.load(memory_order_relaxed);
+        while(n-- > 0 && !blocks.empty() && _size + classSize(k) <= max)
+        {
+            _blocks[k].push_back(blocks.back());
+            blocks.pop_back();
+            _size += classSize(k);
+        }
+    }
+
+private:
+
+    mutex _mutex;
+    vector<Byte*> _blocks[sizeClassCount];
+    size_t _size;
+};
+
+SharedCache&
+sharedCache()
+{
+    static SharedCache cache;
+    return cache;
+}
+
+class ThreadCache
+{
+public:
+
+    ThreadCache() :
+        allocations(0),
+        hits(0),
+        cachedBytes(0)
+    {
+    }
+
+    ~ThreadCache()
+    {
+        threadCacheDestroyed = true;
+        for(size_t k = 0; k < sizeClassCount; ++k)
+        {
+            release(k, blocks[k].size());
+        }
+        flushStats();
+    }
+
+    void flushStats()
+    {
+        poolAllocations += allocations;
+        poolHits += hits;
+        poolCachedBytes += cachedBytes;
+        allocations = 0;
+        hits = 0;
+        cachedBytes = 0;
+    }
+
+    //
+    // Release n blocks of the given size class to the shared cache, the
+    // blocks which don't fit in the shared cache are freed.
+    //
+    void release(size_t k, size_t n)
+    {
+        assert(n <= blocks[k].size());
+        size_t size = blocks[k].size() - n;
+        if(!sharedCacheDestroyed)
+        {
+            sharedCache().put(k, blocks[k], n);
+        }
+        while(blocks[k].size() > size)
+        {
+            ::free(blocks[k].back());
+            blocks[k].pop_back();
+            cachedBytes -= static_cast<int64_t>(classSize(k));
+        }
+    }
+
+    vector<Byte*> blocks[sizeClassCount];
+    int allocations;
+    int hits;
+    int64_t cachedBytes; // The change of the cached bytes since the last flush.
+};
+
+thread_local ThreadCache threadCache;
+
+Byte*
+getBlock(size_t k)
+{
+    if(!threadCacheDestroyed)
+    {
+        ThreadCache& cache = threadCache;
+        if(++cache.allocations == statsFlushInterval)
+        {
+            cache.flushStats();
+        }
+
+        vector<Byte*>& blocks = cache.blocks[k];
+        if(blocks.empty() && !sharedCacheDestroyed)
+        {
+            //
+            // Refill half of the thread cache to amortize the locking of the
+            // shared cache.
+            //
+            size_t max = poolThreadCacheMax.load(memory_order_relaxed);
+            sharedCache().get(k, blocks, max > 1 ? max / 2 : 1);
+        }
+
+        if(!blocks.empty())
+        {
+            ++cache.hits;
+            cache.cachedBytes -= static_cast<int64_t>(classSize(k));
+            Byte* p = blocks.back();
+            blocks.pop_back();
+            return p;
+        }
+    }
+    else
+    {
+        ++poolAllocations;
+        if(!sharedCacheDestroyed)
+        {
+            vector<Byte*> blocks;
+            sharedCache().get(k, blocks, 1);
+            if(!blocks.empty())
+            {
+                ++poolHits;
+                poolCachedBytes -= static_cast<int64_t>(classSize(k));
+                return blocks.back();
+            }
+        }
+    }
+    return reinterpret_cast<Byte*>(::malloc(classSize(k)));
+}
+
+void
+putBlock(Byte* p, size_t k)
+{
+    if(!threadCacheDestroyed)
+    {
+        ThreadCache& cache = threadCache;
+        size_t max = poolThreadCacheMax.load(memory_order_relaxed);
+        cache.blocks[k].push_back(p);
+        cache.cachedBytes += static_cast<int64_t>(classSize(k));
+        if(cache.blocks[k].size() > max)
+        {
+            //
+            // Release half of the thread cache to the shared cache, this
+            // typically happens with threads that release the buffers
+            // allocated by other threads.
+            //
+            cache.release(k, cache.blocks[k].size() - max / 2);
+        }
+    }
+    else
+    {
+        vector<Byte*> blocks(1, p);
+        if(!sharedCacheDestroyed)
+        {
+            sharedCache().put(k, blocks, 1);
+        }
+        if(!blocks.empty())
+        {
+            ::free(p);
+        }
+        else
+        {
+            poolCachedBytes += static_cast<int64_t>(classSize(k));
+        }
+    }
+}
+
+}
+
+bool
+IceInternal::BufferPool::configure(size_t sizeMax, size_t threadCacheMax, size_t cacheSizeMax)
+{
+    //
+    // The settings requested by the communicator which configured the pool, to
+    // check the settings of the other communicators against them.
+    //
+    static mutex configureMutex;
+    static size_t configuredSizeMax;
+    static size_t configuredThreadCacheMax;
+    static size_t configuredCacheSizeMax;
+
+    lock_guard<mutex> lock(configureMutex);
+    if(poolConfigured)
+    {
+        return sizeMax == configuredSizeMax && threadCacheMax == configuredThreadCacheMax &&
+            cacheSizeMax == configuredCacheSizeMax;
+    }
+    configuredSizeMax = sizeMax;
+    configuredThreadCacheMax = threadCacheMax;
+    configuredCacheSizeMax = cacheSizeMax;
+    poolConfigured = true;
+
+    //
+    // Round the maximum size down to a size class, requests rounded up to
+    // their size class never exceed it.
+    //
+    if(sizeMax < sizeClassMin)
+    {
+        sizeMax = 0;
+    }
+    else if(sizeMax >= sizeClassMax)
+    {
+        sizeMax = sizeClassMax;
+    }
+    else
+    {
+        sizeMax = classSize(sizeClass(sizeMax + 1) - 1);
+    }
+
+    poolThreadCacheMax = threadCacheMax;
+    poolCacheSizeMax = cacheSizeMax;
+    poolSizeMax = sizeMax;
+    return true;
+}
+
+Byte*
+IceInternal::BufferPool::allocate(size_t& capacity)
+{
+    if(capacity > poolSizeMax.load(memory_order_relaxed))
+    {
+        return reinterpret_cast<Byte*>(::malloc(capacity));
+    }
+
+    size_t k = sizeClass(capacity);
+    Byte* p = getBlock(k);
+    if(p)
+    {
+        capacity = classSize(k);
+    }
+    return p;
+}
+
+Byte*
+IceInternal::BufferPool::reallocate(Byte* p, size_t capacity, size_t size, size_t& newCapacity)
+{
+    if(!p)
+    {
+        return allocate(newCapacity);
+    }
+
+    if(newCapacity > poolSizeMax.load(memory_order_relaxed))
+    {
+        return reinterpret_cast<Byte*>(::realloc(p, newCapacity));
+    }
+
+    size_t k = sizeClass(newCapacity);
+    if(classSize(k) == capacity)
+    {
+        newCapacity = capacity; // The block is already of the requested size class.
+        return p;
+    }
+
+    Byte* q = getBlock(k);
+    if(q)
+    {
+        newCapacity = classSize(k);
+        memcpy(q, p, min(size, newCapacity));
+        deallocate(p, capacity);
+    }
+    return q;
+}
+
+void
+IceInternal::BufferPool::deallocate(Byte* p, size_t capacity)
+{
+    //
+    // Blocks allocated with malloc/realloc have the requested capacity, they
+    // can also be cached if this capacity matches a size class.
+    //
+    if(!p || capacity > poolSizeMax.load(memory_order_relaxed) || !isClassSize(capacity))
+    {
+        ::free(p);
+        return;
+    }
+    putBlock(p, sizeClass(capacity));
+}
+
+BufferPool::Stats
+IceInternal::BufferPool::stats()
+{
+    if(!threadCacheDestroyed)
+    {
+        threadCache.flushStats();
+    }
+
+    Stats stats;
+    stats.allocations = poolAllocations;
+    stats.hits = poolHits;
+    stats.misses = stats.allocations - stats.hits;
+    stats.cachedBytes = max(poolCachedBytes.load(), int64_t(0));
+    return stats;
+}
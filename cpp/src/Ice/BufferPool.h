@@ -0,0 +1,56 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// Cache of the memory blocks used by Buffer::Container for the stream buffers.
+//
+// Requests up to sizeMax bytes are rounded up to a power of two size class and
+// served from a per-thread cache, which is refilled from and overflows to a
+// cache shared by all the threads. Larger requests use malloc/realloc. Cached
+// blocks are regular malloc blocks, so any block can still be released with
+// free().
+//
+// Buffers are not tied to a communicator and can outlive it, the pool is
+// therefore shared by the process and configured by the first communicator
+// that is initialized. Until then, the pool is disabled. The statistics are
+// also process-wide and include the buffers of all the communicators. The
+// statistics of the other threads are updated every few hundred allocations.
+//
+class BufferPool
+{
+public:
+
+    struct Stats
+    {
+        std::int64_t allocations; // Number of allocations eligible for the pool.
+        std::int64_t hits; // Number of allocations served from a cache.
+        std::int64_t misses; // Number of allocations which had to allocate a new block.
+        std::int64_t cachedBytes; // Size of the blocks kept in the caches.
+    };
+
+    //
+    // Configure the pool with the given maximum block size, thread cache size
+    // and shared cache size. Returns false if the pool is already configured
+    // with different settings, which are kept.
+    //
+    static bool configure(size_t, size_t, size_t);
+
+    static Ice::Byte* allocate(size_t&);
+    static Ice::Byte* reallocate(Ice::Byte*, size_t, size_t, size_t&);
+    static void deallocate(Ice::Byte*, size_t);
+
+    static Stats stats();
+};
+
+}
+
+#endif
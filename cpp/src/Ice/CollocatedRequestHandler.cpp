@@ -124,6 +124,11 @@ CollocatedRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAs
 AsyncStatus
 CollocatedRequestHandler::invokeAsyncRequest(OutgoingAsyncBase* outAsync, int batchRequestNum, bool synchronous)
 {
+    //
+    // The request is dispatched from its stream buffer, copy the bytes it borrowed.
+    //
+    outAsync->getOs()->copyBorrowed();
+
     //
     // Increase the direct count to prevent the thread pool from being destroyed before
     // invokeAll is called. This will also throw if the object adapter has been deactivated.
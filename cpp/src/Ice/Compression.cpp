@@ -0,0 +1,389 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Compression.h>
+#include <Ice/LocalException.h>
+
+#ifdef ICE_HAS_BZIP2
+#  include <bzlib.h>
+#endif
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#ifdef ICE_HAS_BZIP2
+string
+getBZ2Error(int bzError)
+{
+    if(bzError == BZ_RUN_OK)
+    {
+        return ": BZ_RUN_OK";
+    }
+    else if(bzError == BZ_FLUSH_OK)
+    {
+        return ": BZ_FLUSH_OK";
+    }
+    else if(bzError == BZ_FINISH_OK)
+    {
+        return ": BZ_FINISH_OK";
+    }
+    else if(bzError == BZ_STREAM_END)
+    {
+        return ": BZ_STREAM_END";
+    }
+    else if(bzError == BZ_CONFIG_ERROR)
+    {
+        return ": BZ_CONFIG_ERROR";
+    }
+    else if(bzError == BZ_SEQUENCE_ERROR)
+    {
+        return ": BZ_SEQUENCE_ERROR";
+    }
+    else if(bzError == BZ_PARAM_ERROR)
+    {
+        return ": BZ_PARAM_ERROR";
+    }
+    else if(bzError == BZ_MEM_ERROR)
+    {
+        return ": BZ_MEM_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR)
+    {
+        return ": BZ_DATA_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    {
+        return ": BZ_DATA_ERROR_MAGIC";
+    }
+    else if(bzError == BZ_IO_ERROR)
+    {
+        return ": BZ_IO_ERROR";
+    }
+    else if(bzError == BZ_UNEXPECTED_EOF)
+    {
+        return ": BZ_UNEXPECTED_EOF";
+    }
+    else if(bzError == BZ_OUTBUFF_FULL)
+    {
+        return ": BZ_OUTBUFF_FULL";
+    }
+    else
+    {
+        return "";
+    }
+}
+
+class BZip2Codec final : public CompressionCodec
+{
+public:
+
+    BZip2Codec(int level) :
+        _level(level)
+    {
+    }
+
+    Byte status() const final
+    {
+        return compressionStatusBZip2;
+    }
+
+    size_t compressBound(size_t size) const final
+    {
+        return static_cast<size_t>(static_cast<double>(size) * 1.01 + 600);
+    }
+
+    size_t compress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize) final
+    {
+        unsigned int compressedLen = static_cast<unsigned int>(dstSize);
+        int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(dst), &compressedLen,
+                                               const_cast<char*>(reinterpret_cast<const char*>(src)),
+                                               static_cast<unsigned int>(srcSize), _level, 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        }
+        return compressedLen;
+    }
+
+    void uncompress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize) final
+    {
+        unsigned int uncompressedLen = static_cast<unsigned int>(dstSize);
+        int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(dst), &uncompressedLen,
+                                                 const_cast<char*>(reinterpret_cast<const char*>(src)),
+                                                 static_cast<unsigned int>(srcSize), 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        }
+    }
+
+private:
+
+    const int _level;
+};
+#endif
+
+//
+// LZ4 block format: a sequence starts with a token whose high and low 4 bits
+// are the literal length and the match length minus 4, a length of 15 is
+// followed by bytes added to the length until a byte isn't 255. The literals
+// follow the literal length and the 2 bytes little endian match offset follows
+// the literals. The last sequence only has literals, it includes at least the
+// last 5 bytes and the last match starts at least 12 bytes before the end.
+//
+const size_t lz4MinMatch = 4;
+const size_t lz4LastLiterals = 5;
+const size_t lz4MatchFindLimit = 12;
+const size_t lz4MaxOffset = 65535;
+const int lz4HashLog = 12;
+const int lz4SkipTrigger = 6; // Search faster in data which doesn't compress.
+
+inline uint32_t
+read32(const Byte* p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t
+lz4Hash(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - lz4HashLog);
+}
+
+inline Byte*
+lz4WriteLength(Byte* op, size_t length)
+{
+    while(length >= 255)
+    {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<Byte>(length);
+    return op;
+}
+
+inline size_t
+lz4ReadLength(const Byte*& ip, const Byte* iend, size_t length)
+{
+    if(length == 15)
+    {
+        Byte b;
+        do
+        {
+            if(ip == iend)
+            {
+                throw CompressionException(__FILE__, __LINE__, "LZ4 uncompress failed: truncated input");
+            }
+            b = *ip++;
+            length += b;
+        }
+        while(b == 255);
+    }
+    return length;
+}
+
+class LZ4Codec final : public CompressionCodec
+{
+public:
+
+    Byte status() const final
+    {
+        return compressionStatusLZ4;
+    }
+
+    size_t compressBound(size_t size) const final
+    {
+        return size + size / 255 + 16;
+    }
+
+    size_t compress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize) final
+    {
+        if(dstSize < compressBound(srcSize))
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4 compress failed: output buffer too small");
+        }
+
+        //
+        // The hash table is kept from one message to the next to avoid clearing it for
+        // each message. Positions are stored relative to _base, which is advanced by the
+        // size of each message, so the positions of previous messages are below _base and
+        // are ignored. The table is only cleared when _base would overflow.
+        //
+        if(_table.empty() || srcSize > numeric_limits<uint32_t>::max() - _base)
+        {
+            _table.assign(1 << lz4HashLog, 0);
+            _base = 1;
+        }
+        uint32_t* table = &_table[0];
+        const uint32_t base = _base;
+        _base += static_cast<uint32_t>(srcSize);
+
+        Byte* op = dst;
+        size_t anchor = 0;
+        if(srcSize > lz4MatchFindLimit)
+        {
+            const size_t matchLimit = srcSize - lz4LastLiterals;
+            const size_t ipLimit = srcSize - lz4MatchFindLimit;
+            size_t ip = 0;
+            while(ip < ipLimit)
+            {
+                uint32_t sequence = read32(src + ip);
+                uint32_t h = lz4Hash(sequence);
+                uint32_t entry = table[h];
+                table[h] = base + static_cast<uint32_t>(ip);
+                if(entry < base)
+                {
+                    ip += 1 + ((ip - anchor) >> lz4SkipTrigger);
+                    continue;
+                }
+                size_t ref = entry - base;
+                if(ref >= ip || ip - ref > lz4MaxOffset || read32(src + ref) != sequence)
+                {
+                    ip += 1 + ((ip - anchor) >> lz4SkipTrigger);
+                    continue;
+                }
+
+                size_t matchLength = lz4MinMatch;
+                while(ip + matchLength < matchLimit && src[ref + matchLength] == src[ip + matchLength])
+                {
+                    ++matchLength;
+                }
+
+                size_t literalLength = ip - anchor;
+                size_t length = matchLength - lz4MinMatch;
+                Byte* token = op++;
+                *token = static_cast<Byte>((min<size_t>(literalLength, 15) << 4) | min<size_t>(length, 15));
+                if(literalLength >= 15)
+                {
+                    op = lz4WriteLength(op, literalLength - 15);
+                }
+                memcpy(op, src + anchor, literalLength);
+                op += literalLength;
+                size_t offset = ip - ref;
+                *op++ = static_cast<Byte>(offset & 0xFF);
+                *op++ = static_cast<Byte>(offset >> 8);
+                if(length >= 15)
+                {
+                    op = lz4WriteLength(op, length - 15);
+                }
+
+                ip += matchLength;
+                anchor = ip;
+            }
+        }
+
+        size_t literalLength = srcSize - anchor;
+        *op++ = static_cast<Byte>(min<size_t>(literalLength, 15) << 4);
+        if(literalLength >= 15)
+        {
+            op = lz4WriteLength(op, literalLength - 15);
+        }
+        memcpy(op, src + anchor, literalLength);
+        op += literalLength;
+        return static_cast<size_t>(op - dst);
+    }
+
+    void uncompress(const Byte* src, size_t srcSize, Byte* dst, size_t dstSize) final
+    {
+        const Byte* ip = src;
+        const Byte* const iend = src + srcSize;
+        Byte* op = dst;
+        Byte* const oend = dst + dstSize;
+        while(true)
+        {
+            if(ip == iend)
+            {
+                throw CompressionException(__FILE__, __LINE__, "LZ4 uncompress failed: truncated input");
+            }
+            Byte token = *ip++;
+
+            size_t literalLength = lz4ReadLength(ip, iend, static_cast<size_t>(token >> 4));
+            if(literalLength > static_cast<size_t>(iend - ip) || literalLength > static_cast<size_t>(oend - op))
+            {
+                throw CompressionException(__FILE__, __LINE__, "LZ4 uncompress failed: invalid literal length");
+            }
+            memcpy(op, ip, literalLength);
+            op += literalLength;
+            ip += literalLength;
+            if(ip == iend)
+            {
+                break; // Last sequence
+            }
+
+            if(iend - ip < 2)
+            {
+                throw CompressionException(__FILE__, __LINE__, "LZ4 uncompress failed: truncated input");
+            }
+            size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+            ip += 2;
+            if(offset == 0 || offset > static_cast<size_t>(op - dst))
+            {
+                throw CompressionException(__FILE__, __LINE__, "LZ4 uncompress failed: invalid match offset");
+            }
+
+            size_t matchLength = lz4ReadLength(ip, iend, static_cast<size_t>(token & 15)) + lz4MinMatch;
+            if(matchLength > static_cast<size_t>(oend - op))
+            {
+                throw CompressionException(__FILE__, __LINE__, "LZ4 uncompress failed: invalid match length");
+            }
+
+            const Byte* match = op - offset;
+            if(offset >= matchLength)
+            {
+                memcpy(op, match, matchLength);
+                op += matchLength;
+            }
+            else
+            {
+                for(size_t i = 0; i < matchLength; ++i) // Overlapping copy
+                {
+                    *op++ = *match++;
+                }
+            }
+        }
+
+        if(op != oend)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4 uncompress failed: invalid uncompressed size");
+        }
+    }
+
+private:
+
+    vector<uint32_t> _table;
+    uint32_t _base = 1;
+};
+
+}
+
+IceInternal::CompressionCodec::~CompressionCodec()
+{
+    // Out of line to avoid weak vtable
+}
+
+CompressionCodecPtr
+IceInternal::createBZip2Codec(ICE_MAYBE_UNUSED int level)
+{
+#ifdef ICE_HAS_BZIP2
+    return make_unique<BZip2Codec>(level);
+#else
+    return nullptr;
+#endif
+}
+
+CompressionCodecPtr
+IceInternal::createLZ4Codec()
+{
+    return make_unique<LZ4Codec>();
+}
@@ -0,0 +1,79 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COMPRESSION_H
+#define ICE_COMPRESSION_H
+
+#include <Ice/Config.h>
+
+#include <memory>
+
+#ifndef ICE_HAS_BZIP2
+#   define ICE_HAS_BZIP2
+#endif
+
+namespace IceInternal
+{
+
+//
+// The compression status of the protocol message header. Peers which don't
+// support LZ4 ignore the LZ4 status of validate connection messages, a peer
+// only uses LZ4 once it knows that the other peer supports it.
+//
+const Ice::Byte compressionStatusNone = 0; // Not compressed, do not compress response, if any.
+const Ice::Byte compressionStatusBZip2Supported = 1; // Not compressed, compress response, if any.
+const Ice::Byte compressionStatusBZip2 = 2; // Compressed with bzip2, compress response, if any.
+const Ice::Byte compressionStatusLZ4 = 3; // Compressed with LZ4, compress response, if any.
+const Ice::Byte compressionStatusLZ4Supported = 4; // Not compressed, compress response with LZ4 or bzip2, if any.
+
+//
+// A compression codec compresses protocol message bodies. A codec is not
+// thread-safe, each connection uses its own codec instances which allows
+// codecs to keep their compression context from one message to the next.
+//
+class ICE_API CompressionCodec
+{
+public:
+
+    virtual ~CompressionCodec();
+
+    //
+    // The compression status of messages compressed with this codec.
+    //
+    virtual Ice::Byte status() const = 0;
+
+    //
+    // The maximum compressed size of the given number of bytes.
+    //
+    virtual size_t compressBound(size_t) const = 0;
+
+    //
+    // Compress the source bytes into the destination buffer and return the
+    // compressed size. Raises CompressionException on failure.
+    //
+    virtual size_t compress(const Ice::Byte*, size_t, Ice::Byte*, size_t) = 0;
+
+    //
+    // Uncompress the source bytes into the destination buffer, which must be
+    // the size of the uncompressed data. Raises CompressionException on
+    // failure.
+    //
+    virtual void uncompress(const Ice::Byte*, size_t, Ice::Byte*, size_t) = 0;
+};
+using CompressionCodecPtr = std::unique_ptr<CompressionCodec>;
+
+//
+// Returns null if Ice is built without bzip2.
+//
+ICE_API CompressionCodecPtr createBZip2Codec(int);
+
+//
+// The LZ4 codec implements the LZ4 block format, it doesn't depend on the
+// LZ4 library.
+//
+ICE_API CompressionCodecPtr createLZ4Codec();
+
+}
+
+#endif
@@ -23,10 +23,6 @@
 #include <Ice/BatchRequestQueue.h>
 #include "CheckIdentity.h"
 
-#ifdef ICE_HAS_BZIP2
-#  include <bzlib.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -37,6 +33,47 @@ namespace
 
 const ::std::string flushBatchRequests_name = "flushBatchRequests";
 
+//
+// Per-thread cache of the streams adopted by queued outgoing messages, typically
+// replies queued behind other messages. The streams are recycled once their message
+// is sent instead of being deleted. Their buffers are released before the streams
+// are cached, the buffer memory is recycled by the buffer pool.
+//
+const size_t adoptedStreamCacheSize = 16;
+thread_local vector<unique_ptr<OutputStream>> adoptedStreamCache;
+
+OutputStream*
+newAdoptedStream(Instance* instance)
+{
+    if(adoptedStreamCache.empty())
+    {
+        return new OutputStream(instance, currentProtocolEncoding);
+    }
+    OutputStream* stream = adoptedStreamCache.back().release();
+    adoptedStreamCache.pop_back();
+    stream->initialize(instance, currentProtocolEncoding);
+    return stream;
+}
+
+void
+deleteAdoptedStream(OutputStream* stream)
+{
+    if(adoptedStreamCache.size() < adoptedStreamCacheSize)
+    {
+        stream->b.clear();
+        stream->i = stream->b.begin();
+        stream->borrowed().b.clear();
+        stream->borrowed().i = stream->borrowed().b.begin();
+        stream->clear();
+        stream->setClosure(0);
+        adoptedStreamCache.emplace_back(stream);
+    }
+    else
+    {
+        delete stream;
+    }
+}
+
 class TimeoutCallback final : public IceUtil::TimerTask
 {
 public:
@@ -128,6 +165,15 @@ private:
     const bool _close;
 };
 
+//
+// Returns whether or not the stream buffer or the bytes it borrowed have data left to write.
+//
+inline bool
+writePending(OutputStream& stream)
+{
+    return stream.i != stream.b.end() || stream.borrowed().i != stream.borrowed().b.end();
+}
+
 //
 // Class for handling Ice::Connection::begin_flushBatchRequests
 //
@@ -302,7 +348,7 @@ Ice::ConnectionI::OutgoingMessage::adopt(OutputStream* str)
     {
         if(str)
         {
-            delete stream;
+            deleteAdoptedStream(stream);
             stream = 0;
             adopted = false;
         }
@@ -325,7 +371,7 @@ Ice::ConnectionI::OutgoingMessage::adopt(OutputStream* str)
     }
 
     assert(str);
-    stream = new OutputStream(str->instance(), currentProtocolEncoding);
+    stream = newAdoptedStream(str->instance());
     stream->swap(*str);
     adopted = true;
 }
@@ -350,7 +396,7 @@ Ice::ConnectionI::OutgoingMessage::sent()
 {
     if(adopted)
     {
-        delete stream;
+        deleteAdoptedStream(stream);
     }
     stream = 0;
 
@@ -379,7 +425,7 @@ Ice::ConnectionI::OutgoingMessage::completed(std::exception_ptr ex)
 
     if(adopted)
     {
-        delete stream;
+        deleteAdoptedStream(stream);
     }
     stream = 0;
 }
@@ -697,6 +743,20 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     assert(_state > StateNotValidated);
     assert(_state < StateClosing);
 
+    //
+    // Bytes borrowed by the request are sent with a gathered write after the
+    // stream buffer. Copy them if the message is compressed or if the transport
+    // sends messages with a single buffer.
+    //
+#if defined(ICE_USE_IOCP)
+    os->copyBorrowed();
+#else
+    if(compress || _endpoint->datagram())
+    {
+        os->copyBorrowed();
+    }
+#endif
+
     //
     // Ensure the message isn't bigger than what we can send with the
     // transport.
@@ -1045,11 +1105,24 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, exc
             catch (const std::exception&)
             {
                 //
-                // If the request is being sent, don't remove it from the send streams,
-                // it will be removed once the sending is finished.
+                // If the request is being sent or was gathered with the request being
+                // sent, don't remove it from the send streams, it will be removed once
+                // the sending is finished.
                 //
-                if(o == _sendStreams.begin())
+                if(o == _sendStreams.begin() || o->stream->i)
                 {
+                    //
+                    // The caller no longer waits for the request, copy the bytes it lent
+                    // to the request before they are sent.
+                    //
+                    if(o == _sendStreams.begin())
+                    {
+                        _writeStream.copyBorrowed();
+                    }
+                    else
+                    {
+                        o->stream->copyBorrowed();
+                    }
                     o->canceled(true); // true = adopt the stream
                 }
                 else
@@ -1231,6 +1304,18 @@ Ice::ConnectionI::endpoint() const
     return _endpoint; // No mutex protection necessary, _endpoint is immutable.
 }
 
+EndpointStatsPtr
+Ice::ConnectionI::endpointStats()
+{
+    auto stats = atomic_load(&_endpointStats);
+    if(!stats)
+    {
+        stats = _instance->endpointStatsTable()->get(_endpoint);
+        atomic_store(&_endpointStats, stats);
+    }
+    return stats;
+}
+
 ConnectorPtr
 Ice::ConnectionI::connector() const
 {
@@ -2025,6 +2110,8 @@ Ice::ConnectionI::finish(bool close)
     _writeStream.b.clear();
     _readStream.clear();
     _readStream.b.clear();
+    _readAheadBuffer.b.clear();
+    _readAheadI = _readAheadBuffer.i = _readAheadBuffer.b.begin();
 
     if(_closeCallback)
     {
@@ -2147,14 +2234,22 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _readTimeoutScheduled(false),
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
-    _compressionLevel(1),
+    _lz4Codec(createLZ4Codec()),
+    _preferLZ4(false),
+    _peerLZ4(false),
+    _compressionThreshold(100),
     _nextRequestId(1),
     _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
     _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
+    _readAheadSize(0),
+    _readAheadI(0),
+    _readAheadReady(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
+    _compressStream(_instance.get(), Ice::currentProtocolEncoding),
+    _uncompressStream(_instance.get(), Ice::currentProtocolEncoding),
     _dispatchCount(0),
     _state(StateNotInitialized),
     _shutdownInitiated(false),
@@ -2163,8 +2258,7 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
 {
     const Ice::PropertiesPtr& properties = _instance->initializationData().properties;
 
-    int& compressionLevel = const_cast<int&>(_compressionLevel);
-    compressionLevel = properties->getPropertyAsIntWithDefault("Ice.Compression.Level", 1);
+    int compressionLevel = properties->getPropertyAsIntWithDefault("Ice.Compression.Level", 1);
     if(compressionLevel < 1)
     {
         compressionLevel = 1;
@@ -2173,6 +2267,38 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     {
         compressionLevel = 9;
     }
+    _bzip2Codec = createBZip2Codec(compressionLevel);
+
+    string codec = properties->getPropertyWithDefault("Ice.Compression.Codec", "bzip2");
+    if(codec == "lz4")
+    {
+        _preferLZ4 = true;
+    }
+    else if(codec != "bzip2" && _warn)
+    {
+        Warning out(_logger);
+        out << "unknown compression codec `" << codec << "', using bzip2";
+    }
+
+    int compressionThreshold = properties->getPropertyAsIntWithDefault("Ice.Compression.Threshold", 100);
+    _compressionThreshold = compressionThreshold < 0 ? 0 : static_cast<size_t>(compressionThreshold);
+
+#if !defined(ICE_USE_IOCP)
+    //
+    // Stream connections read ahead as much data as the transceiver provides to parse
+    // several messages from a single read. The buffer is allocated on the first read.
+    //
+    if(!_endpoint->datagram())
+    {
+        int32_t readAheadSize = properties->getPropertyAsIntWithDefault("Ice.ReadAheadSize", 64); // 64KB default
+        if(readAheadSize > 0)
+        {
+            // Property is in kilobytes, convert in bytes.
+            const_cast<size_t&>(_readAheadSize) =
+                static_cast<size_t>(min(readAheadSize, static_cast<int32_t>(0x7fffffff / 1024))) * 1024;
+        }
+    }
+#endif
 
     if(adapter)
     {
@@ -2615,7 +2741,18 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+                //
+                // Only advertise LZ4 if compression isn't disabled with Ice.Override.Compress.
+                //
+                const DefaultsAndOverridesPtr& overrides = _instance->defaultsAndOverrides();
+                if(overrides->overrideCompress && !overrides->overrideCompressValue)
+                {
+                    _writeStream.write(compressionStatusNone); // Compression status.
+                }
+                else
+                {
+                    _writeStream.write(compressionStatusLZ4Supported); // Compression status (LZ4 supported).
+                }
                 _writeStream.write(headerSize); // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _logger, _traceLevels);
@@ -2697,7 +2834,8 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 throw ConnectionNotValidatedException(__FILE__, __LINE__);
             }
             Byte compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress); // Only used to tell if the server supports LZ4.
+            _peerLZ4 = compress == compressionStatusLZ4Supported;
             int32_t size;
             _readStream.read(size);
             if(size != headerSize)
@@ -2748,9 +2886,10 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
         return SocketOperationNone;
     }
 
-    assert(!_writeStream.b.empty() && _writeStream.i == _writeStream.b.end());
+    assert(!_writeStream.b.empty() && !writePending(_writeStream));
     try
     {
+        SocketOperation writeOp = SocketOperationNone;
         while(true)
         {
             //
@@ -2759,6 +2898,10 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             OutgoingMessage* message = &_sendStreams.front();
             if(message->stream)
             {
+                if(message->gathered)
+                {
+                    traceSend(_writeStream, _logger, _traceLevels);
+                }
                 _writeStream.swap(*message->stream);
                 if(message->sent())
                 {
@@ -2788,56 +2931,15 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             }
 
             //
-            // Otherwise, prepare the next message stream for writing.
+            // Otherwise, prepare the next message stream for writing. Messages gathered
+            // with a previous message are already prepared and might be partially or
+            // entirely sent.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
+            if(!message->stream->i)
             {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = 2;
-
-                //
-                // Do compression.
-                //
-                OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _logger, _traceLevels);
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
-            }
-            else
-            {
-#endif
-                if(message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                int32_t sz = static_cast<int32_t>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-#else
-                copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-#endif
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
+                prepareMessage(*message, false);
             }
-#endif
             _writeStream.swap(*message->stream);
 
             //
@@ -2848,12 +2950,20 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
                 _observer.startWrite(_writeStream);
             }
             assert(_writeStream.i);
-            if(_writeStream.i != _writeStream.b.end())
+            if(writePending(_writeStream))
             {
-                SocketOperation op = write(_writeStream);
-                if(op)
+                //
+                // If the write blocked after sending gathered messages, don't write again
+                // but keep completing the gathered messages which are entirely sent. The
+                // sent callbacks of these messages are returned with the write operation.
+                //
+                if(!writeOp)
                 {
-                    return op;
+                    writeOp = writeQueuedMessages();
+                }
+                if(writeOp && writePending(_writeStream))
+                {
+                    return writeOp;
                 }
             }
             if(_observer)
@@ -2883,6 +2993,95 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message, bool gathered)
+{
+    //
+    // Gathered messages are traced by sendNextMessage() once they are entirely sent.
+    //
+    assert(!message.stream->i);
+    message.gathered = gathered;
+    if(compressMessage(message, _compressStream))
+    {
+        traceSend(*message.stream, _logger, _traceLevels);
+
+        message.adopt(&_compressStream); // Adopt the compressed stream.
+        message.stream->i = message.stream->b.begin();
+    }
+    else
+    {
+        //
+        // No compression, just fill in the message size.
+        //
+        int32_t sz = static_cast<int32_t>(message.stream->b.size() + message.stream->borrowed().b.size());
+        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+#else
+        copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+#endif
+        message.stream->i = message.stream->b.begin();
+        message.stream->borrowed().i = message.stream->borrowed().b.begin();
+        if(!gathered)
+        {
+            traceSend(*message.stream, _logger, _traceLevels);
+        }
+    }
+}
+
+SocketOperation
+Ice::ConnectionI::writeQueuedMessages()
+{
+    //
+    // Gather the messages queued after the message being sent to write them
+    // along with it using a single system call. The gathered messages are
+    // prepared in queue order and sendNextMessage() completes them in order.
+    //
+    assert(!_sendStreams.empty());
+    const size_t messagesMax = _instance->gatherWriteMessagesMax();
+    if(messagesMax <= 1 || _sendStreams.size() == 1)
+    {
+        return write(_writeStream);
+    }
+
+    const size_t sizeMax = _instance->gatherWriteSizeMax();
+    size_t size = 0;
+    _writeBuffers.clear();
+    addWriteBuffers(_writeStream, size);
+    for(deque<OutgoingMessage>::iterator p = _sendStreams.begin() + 1;
+        p != _sendStreams.end() && _writeBuffers.size() < messagesMax && size < sizeMax; ++p)
+    {
+        if(!p->stream->i)
+        {
+            //
+            // Stop at messages which need to be compressed, their uncompressed stream
+            // is required to trace them and it's only available until they're prepared.
+            //
+            if(p->compress && p->stream->b.size() >= _compressionThreshold)
+            {
+                break;
+            }
+            prepareMessage(*p, true);
+        }
+        addWriteBuffers(*p->stream, size);
+    }
+    return write(_writeBuffers);
+}
+
+void
+Ice::ConnectionI::addWriteBuffers(OutputStream& stream, size_t& size)
+{
+    _writeBuffers.push_back(&stream);
+    size += static_cast<size_t>(stream.b.end() - stream.i);
+
+    Buffer& borrowed = stream.borrowed();
+    if(!borrowed.b.empty())
+    {
+        _writeBuffers.push_back(&borrowed);
+        size += static_cast<size_t>(borrowed.b.end() - borrowed.i);
+    }
+}
+
 AsyncStatus
 Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
@@ -2904,19 +3103,13 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
     message.stream->i = message.stream->b.begin();
     SocketOperation op;
-#ifdef ICE_HAS_BZIP2
-    if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    if(compressMessage(message, _compressStream))
     {
         //
-        // Message compressed. Request compressed response, if any.
+        // The compressed stream is only adopted if the message is queued, otherwise its
+        // buffer is kept to compress the next message.
         //
-        message.stream->b[9] = 2;
-
-        //
-        // Do compression.
-        //
-        OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-        doCompress(*message.stream, stream);
+        OutputStream& stream = _compressStream;
         stream.i = stream.b.begin();
 
         traceSend(*message.stream, _logger, _traceLevels);
@@ -2953,19 +3146,10 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     }
     else
     {
-#endif
-        if(message.compress)
-        {
-            //
-            // Message not compressed. Request compressed response, if any.
-            //
-            message.stream->b[9] = 1;
-        }
-
         //
         // No compression, just fill in the message size.
         //
-        int32_t sz = static_cast<int32_t>(message.stream->b.size());
+        int32_t sz = static_cast<int32_t>(message.stream->b.size() + message.stream->borrowed().b.size());
         const Byte* p = reinterpret_cast<const Byte*>(&sz);
 #ifdef ICE_BIG_ENDIAN
         reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
@@ -2973,6 +3157,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
         copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
 #endif
         message.stream->i = message.stream->b.begin();
+        message.stream->borrowed().i = message.stream->borrowed().b.begin();
 
         traceSend(*message.stream, _logger, _traceLevels);
 
@@ -3004,9 +3189,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
         _sendStreams.push_back(message);
         _sendStreams.back().adopt(0); // Adopt the stream.
-#ifdef ICE_HAS_BZIP2
     }
-#endif
 
     _writeStream.swap(*_sendStreams.back().stream);
     scheduleTimeout(op);
@@ -3014,95 +3197,63 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
+bool
+Ice::ConnectionI::compressMessage(OutgoingMessage& message, OutputStream& compressed)
 {
-    if(bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if(bzError == BZ_FLUSH_OK)
-    {
-        return ": BZ_FLUSH_OK";
-    }
-    else if(bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if(bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if(bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if(bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if(bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if(bzError == BZ_MEM_ERROR)
-    {
-        return ": BZ_MEM_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR)
+    if(!message.compress)
     {
-        return ": BZ_DATA_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR_MAGIC)
-    {
-        return ": BZ_DATA_ERROR_MAGIC";
-    }
-    else if(bzError == BZ_IO_ERROR)
-    {
-        return ": BZ_IO_ERROR";
-    }
-    else if(bzError == BZ_UNEXPECTED_EOF)
-    {
-        return ": BZ_UNEXPECTED_EOF";
+        return false;
     }
-    else if(bzError == BZ_OUTBUFF_FULL)
+
+    //
+    // Request compressed response, if any. Also tell the peer that we support
+    // LZ4 if it does.
+    //
+    message.stream->b[9] = _peerLZ4 ? compressionStatusLZ4Supported : compressionStatusBZip2Supported;
+
+    //
+    // Only compress messages larger than the compression threshold.
+    //
+    if(message.stream->b.size() < _compressionThreshold)
     {
-        return ": BZ_OUTBUFF_FULL";
+        return false;
     }
-    else
+
+    CompressionCodec* codec = _bzip2Codec.get();
+    if(_peerLZ4 && (_preferLZ4 || !codec))
     {
-        return "";
+        codec = _lz4Codec.get();
     }
+    return codec && doCompress(*codec, *message.stream, compressed);
 }
 
-void
-Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed)
+bool
+Ice::ConnectionI::doCompress(CompressionCodec& codec, OutputStream& uncompressed, OutputStream& compressed)
 {
     const Byte* p;
 
     //
-    // Compress the message body, but not the header.
+    // Compress the message body, but not the header. The message is sent
+    // uncompressed if compression doesn't make it smaller.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
-    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-                                           &compressedLen,
-                                           reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                           uncompressedLen,
-                                           _compressionLevel, 0, 0);
-    if(bzError != BZ_OK)
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    compressed.b.resize(headerSize + sizeof(int32_t) + codec.compressBound(uncompressedLen));
+    size_t compressedLen = codec.compress(&uncompressed.b[0] + headerSize,
+                                          uncompressedLen,
+                                          &compressed.b[0] + headerSize + sizeof(int32_t),
+                                          compressed.b.size() - headerSize - sizeof(int32_t));
+    if(compressedLen + sizeof(int32_t) >= uncompressedLen)
     {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        return false;
     }
     compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
 
     //
-    // Write the size of the compressed stream into the header of the
-    // uncompressed stream. Since the header will be copied, this size
-    // will also be in the header of the compressed stream.
+    // Write the compression status and the size of the compressed stream into
+    // the header of the uncompressed stream. Since the header will be copied,
+    // they will also be in the header of the compressed stream.
     //
+    uncompressed.b[9] = codec.status();
     int32_t compressedSize = static_cast<int32_t>(compressed.b.size());
     p = reinterpret_cast<const Byte*>(&compressedSize);
 #ifdef ICE_BIG_ENDIAN
@@ -3127,10 +3278,11 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
     // Copy the header from the uncompressed stream to the compressed one.
     //
     copy(uncompressed.b.begin(), uncompressed.b.begin() + headerSize, compressed.b.begin());
+    return true;
 }
 
 void
-Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
+Ice::ConnectionI::doUncompress(CompressionCodec& codec, InputStream& compressed, InputStream& uncompressed)
 {
     int32_t uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
@@ -3146,21 +3298,13 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(static_cast<size_t>(uncompressedSize));
 
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressedSize - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(int32_t));
-    int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                             &uncompressedLen,
-                                             reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-                                             compressedLen,
-                                             0, 0);
-    if(bzError != BZ_OK)
-    {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
-    }
+    codec.uncompress(&compressed.b[0] + headerSize + sizeof(int32_t),
+                     compressed.b.size() - headerSize - sizeof(int32_t),
+                     &uncompressed.b[0] + headerSize,
+                     static_cast<size_t>(uncompressedSize) - headerSize);
 
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
-#endif
 
 SocketOperation
 Ice::ConnectionI::parseMessage(InputStream& stream, int32_t& invokeNum, int32_t& requestId, Byte& compress,
@@ -3190,15 +3334,22 @@ Ice::ConnectionI::parseMessage(InputStream& stream, int32_t& invokeNum, int32_t&
         stream.read(messageType);
         stream.read(compress);
 
-        if(compress == 2)
+        if(compress == compressionStatusBZip2 || compress == compressionStatusLZ4)
         {
-#ifdef ICE_HAS_BZIP2
-            InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
-            doUncompress(stream, ustream);
-            stream.b.swap(ustream.b);
-#else
-            throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
-#endif
+            CompressionCodec* codec = compress == compressionStatusLZ4 ? _lz4Codec.get() : _bzip2Codec.get();
+            if(!codec)
+            {
+                throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
+            }
+            //
+            // The compressed buffer is kept by the scratch stream for the next message.
+            //
+            doUncompress(*codec, stream, _uncompressStream);
+            stream.b.swap(_uncompressStream.b);
+        }
+        if(compress == compressionStatusLZ4 || compress == compressionStatusLZ4Supported)
+        {
+            _peerLZ4 = true;
         }
         stream.i = stream.b.begin() + headerSize;
 
@@ -3544,6 +3695,11 @@ ConnectionI::toConnectionState(State state) const
 SocketOperation
 ConnectionI::read(Buffer& buf)
 {
+    if(_readAheadSize > 0)
+    {
+        return readAhead(buf);
+    }
+
     Buffer::Container::iterator start = buf.i;
     SocketOperation op = _transceiver->read(buf);
     if(_instance->traceLevels()->network >= 3 && buf.i != start)
@@ -3563,6 +3719,86 @@ ConnectionI::read(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::readAhead(Buffer& buf)
+{
+    SocketOperation op = SocketOperationNone;
+    while(true)
+    {
+        //
+        // Fill the buffer with the data previously read ahead.
+        //
+        size_t n = min(static_cast<size_t>(_readAheadBuffer.i - _readAheadI), static_cast<size_t>(buf.b.end() - buf.i));
+        if(n > 0)
+        {
+            memcpy(buf.i, _readAheadI, n);
+            buf.i += n;
+            _readAheadI += n;
+        }
+
+        if(buf.i == buf.b.end())
+        {
+            break;
+        }
+        else if(op != SocketOperationNone)
+        {
+            return op; // No more data available from the transceiver.
+        }
+
+        //
+        // All the data read ahead is consumed, clear the ready state we might have set
+        // for it before reading more data from the transceiver.
+        //
+        if(_readAheadReady)
+        {
+            _transceiver->getNativeInfo()->ready(SocketOperationRead, false);
+            _readAheadReady = false;
+        }
+
+        //
+        // Read large message bodies directly into the buffer, it's not worth copying
+        // them from the read ahead buffer.
+        //
+        if(static_cast<size_t>(buf.b.end() - buf.i) >= _readAheadSize)
+        {
+            Buffer::Container::iterator start = buf.i;
+            op = _transceiver->read(buf);
+            if(_instance->traceLevels()->network >= 3 && buf.i != start)
+            {
+                Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+                out << "received " << (buf.i - start) << " of " << (buf.b.end() - start) << " bytes via "
+                    << _endpoint->protocol() << "\n" << toString();
+            }
+            return op;
+        }
+
+        if(_readAheadBuffer.b.empty())
+        {
+            _readAheadBuffer.b.resize(_readAheadSize);
+        }
+        _readAheadI = _readAheadBuffer.i = _readAheadBuffer.b.begin();
+
+        op = _transceiver->read(_readAheadBuffer);
+        if(_instance->traceLevels()->network >= 3 && _readAheadBuffer.i != _readAheadI)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "received " << (_readAheadBuffer.i - _readAheadI) << " bytes via " << _endpoint->protocol()
+                << "\n" << toString();
+        }
+    }
+
+    //
+    // If there's data left for the next messages, notify the thread pool that the
+    // connection is ready for reading, the socket might not be readable anymore.
+    //
+    if(_readAheadI != _readAheadBuffer.i)
+    {
+        _transceiver->getNativeInfo()->ready(SocketOperationRead, true);
+        _readAheadReady = true;
+    }
+    return SocketOperationNone;
+}
+
 SocketOperation
 ConnectionI::write(Buffer& buf)
 {
@@ -3581,6 +3817,61 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::write(OutputStream& stream)
+{
+    if(stream.borrowed().b.empty())
+    {
+        return write(static_cast<Buffer&>(stream));
+    }
+
+    //
+    // Write the stream buffer and the bytes it borrowed with a single gathered write.
+    //
+    size_t size = 0;
+    _writeBuffers.clear();
+    addWriteBuffers(stream, size);
+    return write(_writeBuffers);
+}
+
+SocketOperation
+ConnectionI::write(const vector<Buffer*>& bufs)
+{
+    assert(!bufs.empty());
+    Buffer* first = bufs.front();
+    Buffer::Container::iterator start = first->i;
+    size_t size = 0;
+    for(vector<Buffer*>::const_iterator p = bufs.begin(); p != bufs.end(); ++p)
+    {
+        size += static_cast<size_t>((*p)->b.end() - (*p)->i);
+    }
+
+    SocketOperation op = _transceiver->writev(bufs);
+
+    size_t remaining = 0;
+    for(vector<Buffer*>::const_iterator p = bufs.begin(); p != bufs.end(); ++p)
+    {
+        remaining += static_cast<size_t>((*p)->b.end() - (*p)->i);
+    }
+    size_t sent = size - remaining;
+
+    //
+    // The bytes sent from the first buffer are reported by the observer
+    // finishWrite(), report the bytes sent from the gathered buffers here.
+    //
+    if(_observer && sent > static_cast<size_t>(first->i - start))
+    {
+        _observer->sentBytes(static_cast<int>(sent - static_cast<size_t>(first->i - start)));
+    }
+
+    if(_instance->traceLevels()->network >= 3 && sent > 0)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        out << "sent " << sent << " of " << size << " bytes via " << _endpoint->protocol() << "\n" << toString();
+    }
+    return op;
+}
+
 void
 ConnectionI::reap()
 {
@@ -17,6 +17,7 @@
 #include <Ice/ObjectAdapterF.h>
 #include <Ice/ServantManagerF.h>
 #include <Ice/EndpointIF.h>
+#include <Ice/EndpointStats.h>
 #include <Ice/ConnectorF.h>
 #include <Ice/LoggerF.h>
 #include <Ice/TraceLevelsF.h>
@@ -29,16 +30,13 @@
 #include <Ice/ACM.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
+#include <Ice/Compression.h>
 
 #include <condition_variable>
 #include <deque>
 #include <mutex>
 #include <chrono>
 
-#ifndef ICE_HAS_BZIP2
-#   define ICE_HAS_BZIP2
-#endif
-
 namespace IceInternal
 {
 
@@ -86,7 +84,7 @@ public:
     struct OutgoingMessage
     {
         OutgoingMessage(Ice::OutputStream* str, bool comp) :
-            stream(str), compress(comp), requestId(0), adopted(false)
+            stream(str), compress(comp), requestId(0), adopted(false), gathered(false)
 #if defined(ICE_USE_IOCP)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -95,7 +93,7 @@ public:
 
         OutgoingMessage(const IceInternal::OutgoingAsyncBasePtr& o, Ice::OutputStream* str,
                         bool comp, int rid) :
-            stream(str), outAsync(o), compress(comp), requestId(rid), adopted(false)
+            stream(str), outAsync(o), compress(comp), requestId(rid), adopted(false), gathered(false)
 #if defined(ICE_USE_IOCP)
             , isSent(false), invokeSent(false), receivedReply(false)
 #endif
@@ -112,6 +110,7 @@ public:
         bool compress;
         int requestId;
         bool adopted;
+        bool gathered;
 #if defined(ICE_USE_IOCP)
         bool isSent;
         bool invokeSent;
@@ -176,6 +175,7 @@ public:
 
     IceInternal::EndpointIPtr endpoint() const;
     IceInternal::ConnectorPtr connector() const;
+    IceInternal::EndpointStatsPtr endpointStats();
 
     virtual void setAdapter(const ObjectAdapterPtr&); // From Connection.
     virtual ObjectAdapterPtr getAdapter() const noexcept; // From Connection.
@@ -259,11 +259,13 @@ private:
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     IceInternal::SocketOperation sendNextMessage(std::vector<OutgoingMessage>&);
     IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
+    void prepareMessage(OutgoingMessage&, bool);
+    IceInternal::SocketOperation writeQueuedMessages();
+    void addWriteBuffers(Ice::OutputStream&, size_t&);
 
-#ifdef ICE_HAS_BZIP2
-    void doCompress(Ice::OutputStream&, Ice::OutputStream&);
-    void doUncompress(Ice::InputStream&, Ice::InputStream&);
-#endif
+    bool compressMessage(OutgoingMessage&, Ice::OutputStream&);
+    bool doCompress(IceInternal::CompressionCodec&, Ice::OutputStream&, Ice::OutputStream&);
+    void doUncompress(IceInternal::CompressionCodec&, Ice::InputStream&, Ice::InputStream&);
 
     IceInternal::SocketOperation parseMessage(Ice::InputStream&, std::int32_t&, std::int32_t&, Byte&,
                                               IceInternal::ServantManagerPtr&, ObjectAdapterPtr&,
@@ -279,7 +281,10 @@ private:
     Ice::Instrumentation::ConnectionState toConnectionState(State) const;
 
     IceInternal::SocketOperation read(IceInternal::Buffer&);
+    IceInternal::SocketOperation readAhead(IceInternal::Buffer&);
     IceInternal::SocketOperation write(IceInternal::Buffer&);
+    IceInternal::SocketOperation write(Ice::OutputStream&);
+    IceInternal::SocketOperation write(const std::vector<IceInternal::Buffer*>&);
 
     void reap();
 
@@ -291,6 +296,7 @@ private:
     const std::string _type;
     const IceInternal::ConnectorPtr _connector;
     const IceInternal::EndpointIPtr _endpoint;
+    IceInternal::EndpointStatsPtr _endpointStats; // Set on first use, loaded and stored atomically.
 
     mutable Ice::ConnectionInfoPtr _info;
 
@@ -316,7 +322,16 @@ private:
 
     std::chrono::steady_clock::time_point _acmLastActivity;
 
-    const int _compressionLevel;
+    //
+    // The codecs are only used with the connection locked, they keep their compression
+    // context from one message to the next. LZ4 is only used once the peer indicated
+    // that it supports it with the compression status of a message it sent.
+    //
+    IceInternal::CompressionCodecPtr _bzip2Codec;
+    IceInternal::CompressionCodecPtr _lz4Codec;
+    bool _preferLZ4;
+    bool _peerLZ4;
+    size_t _compressionThreshold;
 
     std::int32_t _nextRequestId;
 
@@ -329,10 +344,17 @@ private:
     IceInternal::BatchRequestQueuePtr _batchRequestQueue;
 
     std::deque<OutgoingMessage> _sendStreams;
+    std::vector<IceInternal::Buffer*> _writeBuffers;
 
     Ice::InputStream _readStream;
     bool _readHeader;
+    const size_t _readAheadSize;
+    IceInternal::Buffer _readAheadBuffer;
+    IceInternal::Buffer::Container::iterator _readAheadI;
+    bool _readAheadReady;
     Ice::OutputStream _writeStream;
+    Ice::OutputStream _compressStream; // Scratch stream for compressing messages.
+    Ice::InputStream _uncompressStream; // Scratch stream for uncompressing messages.
 
     Observer _observer;
 
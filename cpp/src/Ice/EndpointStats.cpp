@@ -0,0 +1,187 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/EndpointStats.h>
+#include <Ice/EndpointI.h>
+#include <Ice/DefaultsAndOverrides.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// The time constant of the latency decay, in microseconds.
+//
+const double decayTime = 10.0 * 1000 * 1000;
+
+//
+// The latency sample recorded for a failed invocation or a failure to
+// connect to an endpoint, in microseconds. The endpoint is tried again once this latency has
+// decayed below the latency of the other endpoints.
+//
+const double failurePenalty = 1000.0 * 1000;
+
+//
+// The latency of the endpoints without samples when no endpoint has
+// samples, in microseconds. The endpoints are then sorted by their
+// number of outstanding invocations.
+//
+const double defaultLatency = 1.0;
+
+}
+
+IceInternal::EndpointStats::EndpointStats() :
+    _outstanding(0),
+    _sampled(false),
+    _latency(0),
+    _time(chrono::steady_clock::now())
+{
+}
+
+void
+IceInternal::EndpointStats::started()
+{
+    ++_outstanding;
+}
+
+void
+IceInternal::EndpointStats::succeeded(chrono::steady_clock::duration latency)
+{
+    --_outstanding;
+    sample(static_cast<double>(chrono::duration_cast<chrono::microseconds>(latency).count()));
+}
+
+void
+IceInternal::EndpointStats::failed()
+{
+    --_outstanding;
+    sample(failurePenalty);
+}
+
+void
+IceInternal::EndpointStats::connectFailed()
+{
+    sample(failurePenalty);
+}
+
+double
+IceInternal::EndpointStats::latency() const
+{
+    lock_guard<mutex> lock(_mutex);
+    if(!_sampled)
+    {
+        return -1;
+    }
+    auto elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - _time);
+    return _latency * exp(-static_cast<double>(elapsed.count()) / decayTime);
+}
+
+int
+IceInternal::EndpointStats::outstanding() const
+{
+    return max(_outstanding.load(), 0);
+}
+
+void
+IceInternal::EndpointStats::sample(double latency)
+{
+    lock_guard<mutex> lock(_mutex);
+    auto now = chrono::steady_clock::now();
+    if(!_sampled || latency > _latency)
+    {
+        _sampled = true;
+        _latency = latency;
+    }
+    else
+    {
+        auto elapsed = chrono::duration_cast<chrono::microseconds>(now - _time);
+        double weight = exp(-static_cast<double>(elapsed.count()) / decayTime);
+        _latency = _latency * weight + latency * (1 - weight);
+    }
+    _time = now;
+}
+
+IceInternal::EndpointStatsTable::EndpointStatsTable(const DefaultsAndOverridesPtr& defaultsAndOverrides) :
+    _defaultsAndOverrides(defaultsAndOverrides)
+{
+}
+
+EndpointStatsPtr
+IceInternal::EndpointStatsTable::get(const EndpointIPtr& endpoint)
+{
+    EndpointIPtr k = key(endpoint);
+
+    lock_guard<mutex> lock(_mutex);
+    auto p = _stats.find(k);
+    if(p == _stats.end())
+    {
+        p = _stats.insert(make_pair(k, make_shared<EndpointStats>())).first;
+    }
+    return p->second;
+}
+
+void
+IceInternal::EndpointStatsTable::sort(vector<EndpointIPtr>& endpoints)
+{
+    vector<EndpointStatsPtr> stats;
+    stats.reserve(endpoints.size());
+    {
+        lock_guard<mutex> lock(_mutex);
+        for(const auto& endpoint : endpoints)
+        {
+            auto p = _stats.find(key(endpoint));
+            stats.push_back(p == _stats.end() ? nullptr : p->second);
+        }
+    }
+
+    vector<double> latencies;
+    latencies.reserve(endpoints.size());
+    double lowestLatency = -1;
+    for(const auto& s : stats)
+    {
+        latencies.push_back(s ? s->latency() : -1);
+        if(latencies.back() >= 0 && (lowestLatency < 0 || latencies.back() < lowestLatency))
+        {
+            lowestLatency = latencies.back();
+        }
+    }
+    const double baseline = lowestLatency > 0 ? lowestLatency / 2 : defaultLatency;
+
+    vector<pair<double, EndpointIPtr>> costs;
+    costs.reserve(endpoints.size());
+    for(size_t i = 0; i < endpoints.size(); ++i)
+    {
+        double latency = latencies[i] >= 0 ? latencies[i] : baseline;
+        int outstanding = stats[i] ? stats[i]->outstanding() : 0;
+        costs.push_back(make_pair(latency * (outstanding + 1), endpoints[i]));
+    }
+
+    stable_sort(costs.begin(), costs.end(),
+                [](const pair<double, EndpointIPtr>& lhs, const pair<double, EndpointIPtr>& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+
+    for(size_t i = 0; i < endpoints.size(); ++i)
+    {
+        endpoints[i] = std::move(costs[i].second);
+    }
+}
+
+EndpointIPtr
+IceInternal::EndpointStatsTable::key(const EndpointIPtr& endpoint) const
+{
+    EndpointIPtr k = endpoint;
+    if(_defaultsAndOverrides->overrideTimeout)
+    {
+        k = k->timeout(_defaultsAndOverrides->overrideTimeoutValue);
+    }
+    return k->compress(false);
+}
@@ -0,0 +1,99 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_ENDPOINT_STATS_H
+#define ICE_ENDPOINT_STATS_H
+
+#include <Ice/EndpointIF.h>
+#include <Ice/DefaultsAndOverridesF.h>
+#include <Ice/Comparable.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The latency and load of an endpoint, used by the Adaptive endpoint
+// selection type to prefer the endpoints with the lowest cost.
+//
+// The latency is a peak exponentially weighted moving average of the
+// invocation latencies: a sample larger than the average replaces it,
+// and the weight of the average decays with the time since the last
+// sample. A failed invocation or connection attempt is recorded as a
+// large latency sample, so an endpoint which fails fast doesn't attract
+// more invocations. An endpoint which isn't used anymore recovers as its
+// latency decays.
+//
+class EndpointStats
+{
+public:
+
+    EndpointStats();
+
+    // A twoway invocation is started, succeeded or failed.
+    void started();
+    void succeeded(std::chrono::steady_clock::duration);
+    void failed();
+
+    // A connection to the endpoint can't be established.
+    void connectFailed();
+
+    // The latency in microseconds, or a negative value if there's no samples yet.
+    double latency() const;
+
+    int outstanding() const;
+
+private:
+
+    void sample(double);
+
+    std::atomic<int> _outstanding;
+    mutable std::mutex _mutex;
+    bool _sampled;
+    double _latency; // In microseconds.
+    std::chrono::steady_clock::time_point _time;
+};
+using EndpointStatsPtr = std::shared_ptr<EndpointStats>;
+
+//
+// The stats of the endpoints used by the communicator outgoing
+// connections. Endpoints are compared without their compression flag
+// and with the timeout override applied, as for the connections.
+//
+class EndpointStatsTable
+{
+public:
+
+    EndpointStatsTable(const DefaultsAndOverridesPtr&);
+
+    EndpointStatsPtr get(const EndpointIPtr&);
+
+    //
+    // Sort the endpoints by increasing cost, endpoints with the same
+    // cost keep their order. The cost of an endpoint is its latency
+    // multiplied by its number of outstanding invocations plus one. An
+    // endpoint without samples is given half the lowest latency of the
+    // other endpoints: it's tried first, and only gets a share of the
+    // concurrent invocations until its first invocation completes.
+    //
+    void sort(std::vector<EndpointIPtr>&);
+
+private:
+
+    EndpointIPtr key(const EndpointIPtr&) const;
+
+    const DefaultsAndOverridesPtr _defaultsAndOverrides;
+    std::map<EndpointIPtr, EndpointStatsPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _stats;
+    std::mutex _mutex;
+};
+using EndpointStatsTablePtr = std::shared_ptr<EndpointStatsTable>;
+
+}
+
+#endif
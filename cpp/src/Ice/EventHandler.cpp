@@ -19,7 +19,8 @@ IceInternal::EventHandler::EventHandler() :
     _disabled(SocketOperationNone),
 #endif
     _ready(SocketOperationNone),
-    _registered(SocketOperationNone)
+    _registered(SocketOperationNone),
+    _reactor(0)
 {
 }
 
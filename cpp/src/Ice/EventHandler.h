@@ -61,6 +61,7 @@ protected:
 #endif
     SocketOperation _ready;
     SocketOperation _registered;
+    ThreadPool* _reactor; // The reactor of the handler if its thread pool uses reactors.
 
     friend class ThreadPool;
     friend class ThreadPoolCurrent;
@@ -5,6 +5,8 @@
 #ifndef ICE_HASH_UTIL_H
 #define ICE_HASH_UTIL_H
 
+#include <Ice/Identity.h>
+
 namespace IceInternal
 {
 
@@ -48,6 +50,20 @@ hashAdd(std::int32_t& hashCode, const std::map<K, V>& map)
     }
 }
 
+//
+// Hash function object for unordered containers keyed by identity.
+//
+struct IdentityHash
+{
+    size_t operator()(const Ice::Identity& ident) const
+    {
+        std::int32_t h = 5381;
+        hashAdd(h, ident.name);
+        hashAdd(h, ident.category);
+        return static_cast<std::uint32_t>(h);
+    }
+};
+
 }
 
 #endif
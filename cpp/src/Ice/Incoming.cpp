@@ -19,6 +19,8 @@
 #include <Ice/ResponseHandler.h>
 #include <Ice/StringUtil.h>
 
+#include <atomic>
+
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -31,8 +33,53 @@ extern bool printStackTraces;
 
 }
 
+namespace
+{
+
+//
+// Per-thread cache of the output streams of marshaled results. The stream of a
+// marshaled result is swapped with the reply stream of the dispatch, its buffer
+// memory is recycled by the buffer pool. A cached stream is reused once the cache
+// holds the last reference to it, this avoids allocating a stream for each result.
+//
+const size_t marshaledResultStreamCacheSize = 16;
+thread_local vector<shared_ptr<OutputStream>> marshaledResultStreamCache;
+
+shared_ptr<OutputStream>
+newMarshaledResultStream(const CommunicatorPtr& communicator)
+{
+    for(const auto& stream : marshaledResultStreamCache)
+    {
+        if(stream.use_count() == 1)
+        {
+            //
+            // Synchronize with the release of the last reference, which might have
+            // been released by another thread.
+            //
+            atomic_thread_fence(memory_order_acquire);
+            stream->b.clear();
+            stream->i = stream->b.begin();
+            stream->borrowed().b.clear();
+            stream->borrowed().i = stream->borrowed().b.begin();
+            stream->clear();
+            stream->setClosure(0);
+            stream->initialize(communicator, Ice::currentProtocolEncoding);
+            return stream;
+        }
+    }
+
+    auto stream = make_shared<OutputStream>(communicator, Ice::currentProtocolEncoding);
+    if(marshaledResultStreamCache.size() < marshaledResultStreamCacheSize)
+    {
+        marshaledResultStreamCache.push_back(stream);
+    }
+    return stream;
+}
+
+}
+
 Ice::MarshaledResult::MarshaledResult(const Ice::Current& current) :
-    ostr(make_shared<Ice::OutputStream>(current.adapter->getCommunicator(), Ice::currentProtocolEncoding))
+    ostr(newMarshaledResultStream(current.adapter->getCommunicator()))
 {
     ostr->writeBlob(replyHdr, sizeof(replyHdr));
     ostr->write(current.requestId);
@@ -135,6 +182,23 @@ IncomingBase::writeParamEncaps(const Byte* v, int32_t sz, bool ok)
     }
 }
 
+void
+IncomingBase::writeReply(const Byte* first, const Byte* last)
+{
+    assert(first != last);
+    if(*first == replyUserException)
+    {
+        _observer.userException();
+    }
+
+    if(_response)
+    {
+        _os.writeBlob(replyHdr, sizeof(replyHdr));
+        _os.write(_current.requestId);
+        _os.writeBlob(first, static_cast<size_t>(last - first));
+    }
+}
+
 void
 IceInternal::IncomingBase::setMarshaledResult(const Ice::MarshaledResult& result)
 {
@@ -506,6 +570,7 @@ IceInternal::IncomingBase::handleException(std::exception_ptr exc, bool amd)
 IceInternal::Incoming::Incoming(Instance* instance, ResponseHandler* responseHandler, Ice::Connection* connection,
                                 const ObjectAdapterPtr& adapter, bool response, Byte compress, int32_t requestId) :
     IncomingBase(instance, responseHandler, connection, adapter, response, compress, requestId),
+    _requestPos(0),
     _inParamPos(0)
 {
 }
@@ -553,6 +618,7 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, InputStre
     _is = stream;
 
     InputStream::Container::iterator start = _is->i;
+    _requestPos = start;
 
     //
     // Read the current.
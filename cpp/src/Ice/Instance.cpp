@@ -13,6 +13,7 @@
 #include <Ice/ReferenceFactory.h>
 #include <Ice/ProxyFactory.h>
 #include <Ice/ThreadPool.h>
+#include <Ice/BufferPool.h>
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ValueFactoryManagerI.h>
 #include <Ice/LocalException.h>
@@ -189,7 +190,8 @@ class Timer final : public IceUtil::Timer
 {
 public:
 
-    Timer() :
+    Timer(chrono::milliseconds resolution) :
+        IceUtil::Timer(resolution),
         _hasObserver(false)
     {
     }
@@ -401,6 +403,16 @@ IceInternal::Instance::networkProxy() const
     return _networkProxy;
 }
 
+BufferPool::Stats
+IceInternal::Instance::bufferPoolStats() const
+{
+    //
+    // The pool isn't tied to the communicator, the statistics include the buffers of
+    // all the communicators.
+    //
+    return BufferPool::stats();
+}
+
 ThreadPoolPtr
 IceInternal::Instance::clientThreadPool()
 {
@@ -911,6 +923,8 @@ IceInternal::Instance::Instance(const InitializationData& initData) :
     _messageSizeMax(0),
     _batchAutoFlushSize(0),
     _classGraphDepthMax(0),
+    _gatherWriteMessagesMax(0),
+    _gatherWriteSizeMax(0),
     _toStringMode(ToStringMode::Unicode),
     _acceptClassCycles(false),
     _stringConverter(Ice::getProcessStringConverter()),
@@ -1104,6 +1118,8 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
         const_cast<DefaultsAndOverridesPtr&>(_defaultsAndOverrides) =
             make_shared<DefaultsAndOverrides>(_initData.properties, _initData.logger);
 
+        const_cast<EndpointStatsTablePtr&>(_endpointStatsTable) = make_shared<EndpointStatsTable>(_defaultsAndOverrides);
+
         const ACMConfig defaultClientACM(_initData.properties, _initData.logger, "Ice.ACM", ACMConfig(false));
         const ACMConfig defaultServerACM(_initData.properties, _initData.logger, "Ice.ACM", ACMConfig(true));
 
@@ -1170,6 +1186,57 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
             }
         }
 
+        {
+            //
+            // The maximum number of queued messages a connection writes with a single
+            // system call, a value lower or equal to 1 disables gathering.
+            //
+            static const int defaultValue = 64;
+            int32_t num = _initData.properties->getPropertyAsIntWithDefault("Ice.GatherWriteMessagesMax",
+                                                                            defaultValue);
+            const_cast<size_t&>(_gatherWriteMessagesMax) = num < 1 ? 1 : static_cast<size_t>(num);
+
+            num = _initData.properties->getPropertyAsIntWithDefault("Ice.GatherWriteSizeMax", 256); // 256KB default
+            if(num < 1 || static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_gatherWriteSizeMax) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_gatherWriteSizeMax) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        {
+            //
+            // The buffer pool is shared by the process, only the first communicator
+            // configures it and the other communicators warn if their settings
+            // differ. The sizes are in kilobytes and 0 disables the pool.
+            //
+            int32_t sizeMax = _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.SizeMax", 64);
+            int32_t threadCacheMax =
+                _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.ThreadCacheMax", 8);
+            int32_t cacheSizeMax =
+                _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.CacheSizeMax", 4096);
+            if(sizeMax < 0 || static_cast<size_t>(sizeMax) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                sizeMax = 0x7fffffff / 1024;
+            }
+            if(cacheSizeMax < 0 || static_cast<size_t>(cacheSizeMax) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                cacheSizeMax = 0x7fffffff / 1024;
+            }
+            if(!BufferPool::configure(static_cast<size_t>(sizeMax) * 1024,
+                                      threadCacheMax < 0 ? 0 : static_cast<size_t>(threadCacheMax),
+                                      static_cast<size_t>(cacheSizeMax) * 1024))
+            {
+                Warning out(_initData.logger);
+                out << "Ice.BufferPool properties ignored: the buffer pool is shared by the process and is "
+                    << "already configured by another communicator with different settings";
+            }
+        }
+
         string toStringModeStr = _initData.properties->getPropertyWithDefault("Ice.ToStringMode", "Unicode");
         if(toStringModeStr == "ASCII")
         {
@@ -1485,7 +1552,12 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     //
     try
     {
-        _timer = make_shared<Timer>();
+        //
+        // With a resolution, the timer uses a timing wheel which is better suited to a large
+        // number of connection and invocation timeouts.
+        //
+        int resolution = _initData.properties->getPropertyAsInt("Ice.TimerResolution");
+        _timer = make_shared<Timer>(chrono::milliseconds(resolution > 0 ? resolution : 0));
     }
     catch (const IceUtil::Exception& ex)
     {
@@ -1707,6 +1779,18 @@ IceInternal::Instance::destroy()
         _endpointFactoryManager->destroy();
     }
 
+    if(_traceLevels->bufferPool >= 1)
+    {
+        BufferPool::Stats stats = bufferPoolStats();
+        Trace out(_initData.logger, _traceLevels->bufferPoolCat);
+        out << "process buffer pool: allocations = " << stats.allocations << ", cache hits = " << stats.hits;
+        if(stats.allocations > 0)
+        {
+            out << " (" << (stats.hits * 100 / stats.allocations) << "%)";
+        }
+        out << ", cache misses = " << stats.misses << ", cached bytes = " << stats.cachedBytes;
+    }
+
     if(_initData.properties->getPropertyAsInt("Ice.Warn.UnusedProperties") > 0)
     {
         set<string> unusedProperties = static_cast<PropertiesI*>(_initData.properties.get())->getUnusedProperties();
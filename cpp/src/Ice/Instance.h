@@ -13,12 +13,14 @@
 #include <Ice/InstrumentationF.h>
 #include <Ice/TraceLevelsF.h>
 #include <Ice/DefaultsAndOverridesF.h>
+#include <Ice/EndpointStats.h>
 #include <Ice/RouterInfoF.h>
 #include <Ice/LocatorInfoF.h>
 #include <Ice/ReferenceFactoryF.h>
 #include <Ice/ThreadPoolF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ACM.h>
+#include <Ice/BufferPool.h>
 #include <Ice/ObjectAdapterFactoryF.h>
 #include <Ice/EndpointFactoryManagerF.h>
 #include <Ice/IPEndpointIF.h>
@@ -80,6 +82,7 @@ public:
     const Ice::InitializationData& initializationData() const { return _initData; }
     TraceLevelsPtr traceLevels() const;
     DefaultsAndOverridesPtr defaultsAndOverrides() const;
+    const EndpointStatsTablePtr& endpointStatsTable() const { return _endpointStatsTable; }
     RouterManagerPtr routerManager() const;
     LocatorManagerPtr locatorManager() const;
     ReferenceFactoryPtr referenceFactory() const;
@@ -101,6 +104,10 @@ public:
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
     size_t classGraphDepthMax() const { return _classGraphDepthMax; }
+    size_t gatherWriteMessagesMax() const { return _gatherWriteMessagesMax; }
+    size_t gatherWriteSizeMax() const { return _gatherWriteSizeMax; }
+    // The statistics of the buffer pool, which is shared by all the communicators of the process.
+    ICE_API BufferPool::Stats bufferPoolStats() const;
     Ice::ToStringMode toStringMode() const { return _toStringMode; }
     bool acceptClassCycles() const { return _acceptClassCycles; }
     const ACMConfig& clientACM() const;
@@ -155,9 +162,12 @@ private:
     Ice::InitializationData _initData;
     const TraceLevelsPtr _traceLevels; // Immutable, not reset by destroy().
     const DefaultsAndOverridesPtr _defaultsAndOverrides; // Immutable, not reset by destroy().
+    const EndpointStatsTablePtr _endpointStatsTable; // Immutable, not reset by destroy().
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
     const size_t _classGraphDepthMax; // Immutable, not reset by destroy().
+    const size_t _gatherWriteMessagesMax; // Immutable, not reset by destroy().
+    const size_t _gatherWriteSizeMax; // Immutable, not reset by destroy().
     const Ice::ToStringMode _toStringMode; // Immutable, not reset by destroy()
     const bool _acceptClassCycles; // Immutable, not reset by destroy()
     ACMConfig _clientACM;
@@ -12,6 +12,10 @@ ifeq ($(DEFAULT_MUTEX_PROTOCOL), PrioInherit)
     Ice_cppflags        += -DICE_PRIO_INHERIT
 endif
 
+ifeq ($(USE_IO_URING), yes)
+    Ice_cppflags        += -DICE_USE_IO_URING
+endif
+
 Ice_sliceflags          := --include-dir Ice
 Ice_libs                := bz2
 Ice_extra_sources       := $(wildcard src/IceUtil/*.cpp)
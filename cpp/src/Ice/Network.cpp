@@ -86,7 +86,7 @@ public:
 void
 sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
 {
-    if(selType == Ice::EndpointSelectionType::Random)
+    if(selType != Ice::EndpointSelectionType::Ordered)
     {
         IceUtilInternal::shuffle(addrs.begin(), addrs.end());
     }
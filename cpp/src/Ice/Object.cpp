@@ -137,45 +137,61 @@ Ice::Object::ice_dispatch(Request& request, std::function<bool()> r, std::functi
 bool
 Ice::Object::_iceDispatch(Incoming& in, const Current& current)
 {
-    static constexpr string_view allOperations[] =
-    {
-        "ice_id",
-        "ice_ids",
-        "ice_isA",
-        "ice_ping"
-    };
-
-    pair<const string_view*, const string_view*> r = equal_range(allOperations, allOperations + 4, current.operation);
-
-    if(r.first == r.second)
-    {
-        throw OperationNotExistException(__FILE__, __LINE__, current.id, current.facet, current.operation);
-    }
-
-    switch(r.first - allOperations)
+    //
+    // Switch on the operation length and on the characters which discriminate the
+    // operation names, like the dispatch code generated by slice2cpp.
+    //
+    switch(current.operation.size())
     {
-        case 0:
+        case 6:
         {
-            return _iceD_ice_id(in, current);
+            if(current.operation == "ice_id")
+            {
+                return _iceD_ice_id(in, current);
+            }
+            break;
         }
-        case 1:
+        case 7:
         {
-            return _iceD_ice_ids(in, current);
-        }
-        case 2:
-        {
-            return _iceD_ice_isA(in, current);
+            switch(current.operation[6])
+            {
+                case 'A':
+                {
+                    if(current.operation == "ice_isA")
+                    {
+                        return _iceD_ice_isA(in, current);
+                    }
+                    break;
+                }
+                case 's':
+                {
+                    if(current.operation == "ice_ids")
+                    {
+                        return _iceD_ice_ids(in, current);
+                    }
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+            break;
         }
-        case 3:
+        case 8:
         {
-            return _iceD_ice_ping(in, current);
+            if(current.operation == "ice_ping")
+            {
+                return _iceD_ice_ping(in, current);
+            }
+            break;
         }
         default:
         {
-            assert(false);
-            throw OperationNotExistException(__FILE__, __LINE__, current.id, current.facet, current.operation);
+            break;
         }
     }
+    throw OperationNotExistException(__FILE__, __LINE__, current.id, current.facet, current.operation);
 }
 
 namespace
@@ -308,3 +324,28 @@ Ice::BlobjectArrayAsync::_iceDispatch(Incoming& in, const Current& current)
                     async->exception(), current);
     return false;
 }
+
+bool
+Ice::BlobjectForwardAsync::_iceDispatch(Incoming& in, const Current& current)
+{
+    const Byte* request = in.requestPos();
+    pair<const Byte*, const Byte*> inEncaps;
+    int32_t sz;
+    in.readParamEncaps(inEncaps.first, sz);
+    inEncaps.second = inEncaps.first + sz;
+    auto async = IncomingAsync::create(in);
+    ice_invokeAsync({ request, inEncaps.second },
+                    inEncaps,
+                    [async](bool ok, const pair<const Byte*, const Byte*>& outE)
+                    {
+                        async->writeParamEncaps(outE.first, static_cast<int32_t>(outE.second - outE.first), ok);
+                        async->completed();
+                    },
+                    [async](const pair<const Byte*, const Byte*>& reply)
+                    {
+                        async->writeReply(reply.first, reply.second);
+                        async->completed();
+                    },
+                    async->exception(), current);
+    return false;
+}
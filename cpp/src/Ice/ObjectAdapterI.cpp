@@ -1373,6 +1373,7 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Locator.EncodingVersion",
         "Locator.EndpointSelection",
         "Locator.ConnectionCached",
+        "Locator.ConnectionPoolSize",
         "Locator.PreferSecure",
         "Locator.CollocationOptimized",
         "Locator.Router",
@@ -1383,11 +1384,13 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Router.EncodingVersion",
         "Router.EndpointSelection",
         "Router.ConnectionCached",
+        "Router.ConnectionPoolSize",
         "Router.PreferSecure",
         "Router.CollocationOptimized",
         "Router.Locator",
         "Router.Locator.EndpointSelection",
         "Router.Locator.ConnectionCached",
+        "Router.Locator.ConnectionPoolSize",
         "Router.Locator.PreferSecure",
         "Router.Locator.CollocationOptimized",
         "Router.Locator.LocatorCacheTimeout",
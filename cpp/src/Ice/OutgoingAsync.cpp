@@ -367,6 +367,8 @@ OutgoingAsyncBase::warning() const
 bool
 ProxyOutgoingAsyncBase::exception(std::exception_ptr exc)
 {
+    endpointStatsFinished(false);
+
     if(_childObserver)
     {
         _childObserver.failed(getExceptionId(exc));
@@ -600,6 +602,7 @@ ProxyOutgoingAsyncBase::sentImpl(bool done)
 bool
 ProxyOutgoingAsyncBase::exceptionImpl(std::exception_ptr ex)
 {
+    endpointStatsFinished(false);
     if(_proxy._getReference()->getInvocationTimeout() != -1)
     {
         _instance->timer()->cancel(shared_from_this());
@@ -610,6 +613,7 @@ ProxyOutgoingAsyncBase::exceptionImpl(std::exception_ptr ex)
 bool
 ProxyOutgoingAsyncBase::responseImpl(bool ok, bool invoke)
 {
+    endpointStatsFinished(true); // A user exception is a successful invocation for the endpoint.
     if(_proxy._getReference()->getInvocationTimeout() != -1)
     {
         _instance->timer()->cancel(shared_from_this());
@@ -856,10 +860,45 @@ OutgoingAsync::response()
     }
 }
 
+void
+ProxyOutgoingAsyncBase::endpointStatsStarted(const ConnectionIPtr& connection)
+{
+    assert(!atomic_load(&_endpointStats));
+    auto stats = connection->endpointStats();
+    _endpointStatsTime = chrono::steady_clock::now();
+    stats->started();
+    atomic_store(&_endpointStats, stats);
+}
+
+void
+ProxyOutgoingAsyncBase::endpointStatsFinished(bool success)
+{
+    //
+    // Failures are recorded as a penalty rather than as a latency sample:
+    // a failing endpoint usually fails fast and would otherwise look fast.
+    //
+    auto stats = atomic_exchange(&_endpointStats, shared_ptr<EndpointStats>());
+    if(stats)
+    {
+        if(success)
+        {
+            stats->succeeded(chrono::steady_clock::now() - _endpointStatsTime);
+        }
+        else
+        {
+            stats->failed();
+        }
+    }
+}
+
 AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
     _cachedConnection = connection;
+    if(response && _proxy._getReference()->getEndpointSelection() == EndpointSelectionType::Adaptive)
+    {
+        endpointStatsStarted(connection);
+    }
     return connection->sendAsyncRequest(shared_from_this(), compress, response, 0);
 }
 
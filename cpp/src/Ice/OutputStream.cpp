@@ -167,6 +167,7 @@ void
 Ice::OutputStream::swap(OutputStream& other)
 {
     swapBuffer(other);
+    _borrowed.swapBuffer(other._borrowed);
 
     std::swap(_instance, other._instance);
     std::swap(_closure, other._closure);
@@ -247,6 +248,38 @@ Ice::OutputStream::writeBlob(const vector<Byte>& v)
     }
 }
 
+void
+Ice::OutputStream::writeBorrowed(const Byte* begin, const Byte* end)
+{
+    assert(_borrowed.b.empty());
+    Buffer borrowed(begin, end);
+    _borrowed.swapBuffer(borrowed);
+}
+
+void
+Ice::OutputStream::copyBorrowed()
+{
+    if(_borrowed.b.empty())
+    {
+        return;
+    }
+
+    //
+    // Keep the position of the stream if it's being sent, the borrowed bytes
+    // are only sent once the stream buffer is entirely sent.
+    //
+    ptrdiff_t sent = i ? (i - b.begin()) + (_borrowed.i - _borrowed.b.begin()) : 0;
+    Container::size_type sz = b.size();
+    resize(sz + _borrowed.b.size());
+    memcpy(&b[sz], _borrowed.b.begin(), _borrowed.b.size());
+    if(i)
+    {
+        i = b.begin() + sent;
+    }
+    _borrowed.b.clear();
+    _borrowed.i = _borrowed.b.begin();
+}
+
 void
 Ice::OutputStream::write(const Byte* begin, const Byte* end)
 {
@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue Feb 27 13:31:46 2024
+// Generated by makeprops.py from file PropertyNames.xml, Sat Oct 17 04:22:19 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -32,6 +32,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Endpoints", false, 0),
     IceInternal::Property("Ice.Admin.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Admin.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Admin.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Locator.InvocationTimeout", false, 0),
@@ -44,6 +45,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ReplicaGroupId", false, 0),
     IceInternal::Property("Ice.Admin.Router.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Admin.Router.ConnectionCached", false, 0),
+    IceInternal::Property("Ice.Admin.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Admin.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Router.InvocationTimeout", false, 0),
@@ -53,6 +55,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.Context.*", false, 0),
     IceInternal::Property("Ice.Admin.Router", false, 0),
     IceInternal::Property("Ice.Admin.ProxyOptions", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.Reactors", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.Size", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.SizeWarn", false, 0),
@@ -72,18 +75,25 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BufferPool.CacheSizeMax", false, 0),
+    IceInternal::Property("Ice.BufferPool.SizeMax", false, 0),
+    IceInternal::Property("Ice.BufferPool.ThreadCacheMax", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClassGraphDepthMax", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
+    IceInternal::Property("Ice.Compression.Codec", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
+    IceInternal::Property("Ice.Compression.Threshold", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
+    IceInternal::Property("Ice.Default.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
     IceInternal::Property("Ice.Default.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Host", false, 0),
     IceInternal::Property("Ice.Default.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("Ice.Default.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Locator.InvocationTimeout", false, 0),
@@ -99,6 +109,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Protocol", false, 0),
     IceInternal::Property("Ice.Default.Router.EndpointSelection", false, 0),
     IceInternal::Property("Ice.Default.Router.ConnectionCached", false, 0),
+    IceInternal::Property("Ice.Default.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.Default.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Router.InvocationTimeout", false, 0),
@@ -112,6 +123,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Timeout", false, 0),
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
+    IceInternal::Property("Ice.GatherWriteMessagesMax", false, 0),
+    IceInternal::Property("Ice.GatherWriteSizeMax", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
@@ -137,6 +150,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
+    IceInternal::Property("Ice.ReadAheadSize", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
@@ -144,6 +158,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.StdErr", false, 0),
     IceInternal::Property("Ice.StdOut", false, 0),
     IceInternal::Property("Ice.SyslogFacility", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.Reactors", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.SizeWarn", false, 0),
@@ -151,6 +166,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.Reactors", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeMax", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
@@ -159,9 +175,11 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.TimerResolution", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
+    IceInternal::Property("Ice.Trace.BufferPool", false, 0),
     IceInternal::Property("Ice.Trace.Locator", false, 0),
     IceInternal::Property("Ice.Trace.Network", false, 0),
     IceInternal::Property("Ice.Trace.Protocol", false, 0),
@@ -216,6 +234,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.InvocationTimeout", false, 0),
@@ -228,6 +247,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ReplicaGroupId", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.InvocationTimeout", false, 0),
@@ -237,6 +257,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Router.Context.*", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ProxyOptions", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Size", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.SizeWarn", false, 0),
@@ -253,6 +274,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.InvocationTimeout", false, 0),
@@ -265,6 +287,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ReplicaGroupId", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.InvocationTimeout", false, 0),
@@ -274,6 +297,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Router.Context.*", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ProxyOptions", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Size", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
@@ -290,6 +314,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.InvocationTimeout", false, 0),
@@ -302,6 +327,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ReplicaGroupId", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.InvocationTimeout", false, 0),
@@ -311,6 +337,7 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Router.Context.*", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ProxyOptions", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Size", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
@@ -343,6 +370,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.InvocationTimeout", false, 0),
@@ -355,6 +383,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ReplicaGroupId", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.InvocationTimeout", false, 0),
@@ -364,6 +393,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Context.*", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ProxyOptions", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Size", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
@@ -380,6 +410,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.InvocationTimeout", false, 0),
@@ -392,6 +423,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.ReplicaGroupId", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.InvocationTimeout", false, 0),
@@ -401,6 +433,7 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Context.*", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ProxyOptions", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Size", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
@@ -453,6 +486,7 @@ const IceInternal::Property IceBoxAdminPropsData[] =
 {
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.EndpointSelection", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionCached", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, 0),
@@ -477,6 +511,7 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.Endpoints", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceBridge.Source.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.InvocationTimeout", false, 0),
@@ -489,6 +524,7 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ReplicaGroupId", false, 0),
     IceInternal::Property("IceBridge.Source.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceBridge.Source.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceBridge.Source.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceBridge.Source.Router.PreferSecure", false, 0),
     IceInternal::Property("IceBridge.Source.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBridge.Source.Router.InvocationTimeout", false, 0),
@@ -498,6 +534,7 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.Router.Context.*", false, 0),
     IceInternal::Property("IceBridge.Source.Router", false, 0),
     IceInternal::Property("IceBridge.Source.ProxyOptions", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.Size", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.SizeWarn", false, 0),
@@ -532,6 +569,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.InvocationTimeout", false, 0),
@@ -544,6 +582,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.InvocationTimeout", false, 0),
@@ -553,6 +592,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.Router.Context.*", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ProxyOptions", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.SizeWarn", false, 0),
@@ -572,6 +612,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, 0),
@@ -584,6 +625,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, 0),
@@ -593,6 +635,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Context.*", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ProxyOptions", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.SizeWarn", false, 0),
@@ -609,6 +652,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Endpoints", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.InvocationTimeout", false, 0),
@@ -621,6 +665,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.InvocationTimeout", false, 0),
@@ -630,6 +675,7 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Context.*", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ProxyOptions", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.SizeWarn", false, 0),
@@ -656,6 +702,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Endpoints", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.InvocationTimeout", false, 0),
@@ -668,6 +715,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.InvocationTimeout", false, 0),
@@ -677,6 +725,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.SizeWarn", false, 0),
@@ -694,6 +743,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.InvocationTimeout", false, 0),
@@ -706,6 +756,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.Node.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Node.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Router.InvocationTimeout", false, 0),
@@ -715,6 +766,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Node.Router", false, 0),
     IceInternal::Property("IceGrid.Node.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.SizeWarn", false, 0),
@@ -743,6 +795,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccounts", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.InvocationTimeout", false, 0),
@@ -755,6 +808,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminCryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, 0),
@@ -772,6 +826,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.InvocationTimeout", false, 0),
@@ -784,6 +839,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.InvocationTimeout", false, 0),
@@ -793,6 +849,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.SizeWarn", false, 0),
@@ -803,6 +860,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.InvocationTimeout", false, 0),
@@ -819,6 +877,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.InvocationTimeout", false, 0),
@@ -831,6 +890,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.InvocationTimeout", false, 0),
@@ -840,6 +900,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.SizeWarn", false, 0),
@@ -858,6 +919,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, 0),
@@ -870,6 +932,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.InvocationTimeout", false, 0),
@@ -879,6 +942,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.SizeWarn", false, 0),
@@ -900,6 +964,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.InvocationTimeout", false, 0),
@@ -912,6 +977,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.InvocationTimeout", false, 0),
@@ -921,6 +987,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.SizeWarn", false, 0),
@@ -934,6 +1001,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, 0),
@@ -954,6 +1022,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.InvocationTimeout", false, 0),
@@ -966,6 +1035,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.InvocationTimeout", false, 0),
@@ -975,6 +1045,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.SizeWarn", false, 0),
@@ -992,6 +1063,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Endpoints", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, 0),
@@ -1004,6 +1076,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ReplicaGroupId", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, 0),
@@ -1013,6 +1086,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Context.*", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ProxyOptions", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Size", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.SizeWarn", false, 0),
@@ -1024,6 +1098,7 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, 0),
@@ -1063,6 +1138,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Endpoints", false, 0),
     IceInternal::Property("IcePatch2.Locator.EndpointSelection", false, 0),
     IceInternal::Property("IcePatch2.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("IcePatch2.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("IcePatch2.Locator.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Locator.InvocationTimeout", false, 0),
@@ -1075,6 +1151,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ReplicaGroupId", false, 0),
     IceInternal::Property("IcePatch2.Router.EndpointSelection", false, 0),
     IceInternal::Property("IcePatch2.Router.ConnectionCached", false, 0),
+    IceInternal::Property("IcePatch2.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("IcePatch2.Router.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Router.InvocationTimeout", false, 0),
@@ -1084,6 +1161,7 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.Context.*", false, 0),
     IceInternal::Property("IcePatch2.Router", false, 0),
     IceInternal::Property("IcePatch2.ProxyOptions", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.Reactors", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.Size", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.SizeWarn", false, 0),
@@ -1199,6 +1277,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.InvocationTimeout", false, 0),
@@ -1211,6 +1290,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ReplicaGroupId", false, 0),
     IceInternal::Property("Glacier2.Client.Router.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Client.Router.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Router.InvocationTimeout", false, 0),
@@ -1220,6 +1300,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.Context.*", false, 0),
     IceInternal::Property("Glacier2.Client.Router", false, 0),
     IceInternal::Property("Glacier2.Client.ProxyOptions", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.Reactors", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.Size", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.SizeWarn", false, 0),
@@ -1230,6 +1311,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
+    IceInternal::Property("Glacier2.Client.RequestQueueThreads", false, 0),
     IceInternal::Property("Glacier2.Client.SleepTime", false, 0),
     IceInternal::Property("Glacier2.Client.Trace.Override", false, 0),
     IceInternal::Property("Glacier2.Client.Trace.Reject", false, 0),
@@ -1245,6 +1327,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.InstanceName", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.InvocationTimeout", false, 0),
@@ -1256,6 +1339,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.ReturnClientProxy", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, 0),
@@ -1273,6 +1357,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Endpoints", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.InvocationTimeout", false, 0),
@@ -1285,6 +1370,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ReplicaGroupId", false, 0),
     IceInternal::Property("Glacier2.Server.Router.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.Server.Router.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Router.InvocationTimeout", false, 0),
@@ -1294,6 +1380,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.Context.*", false, 0),
     IceInternal::Property("Glacier2.Server.Router", false, 0),
     IceInternal::Property("Glacier2.Server.ProxyOptions", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.Reactors", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.Size", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.SizeMax", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.SizeWarn", false, 0),
@@ -1304,11 +1391,13 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
+    IceInternal::Property("Glacier2.Server.RequestQueueThreads", false, 0),
     IceInternal::Property("Glacier2.Server.SleepTime", false, 0),
     IceInternal::Property("Glacier2.Server.Trace.Override", false, 0),
     IceInternal::Property("Glacier2.Server.Trace.Request", false, 0),
     IceInternal::Property("Glacier2.SessionManager.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.SessionManager.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.SessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SessionManager.InvocationTimeout", false, 0),
@@ -1319,6 +1408,7 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SessionManager", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.EndpointSelection", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.ConnectionCached", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.ConnectionPoolSize", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.InvocationTimeout", false, 0),
@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ./config/PropertyNames.xml, Tue Feb 27 13:31:46 2024
+// Generated by makeprops.py from file PropertyNames.xml, Sat Oct 17 04:22:19 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
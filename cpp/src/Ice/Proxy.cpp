@@ -147,6 +147,12 @@ Ice::ObjectPrx::ice_isConnectionCached() const
     return _reference->getCacheConnection();
 }
 
+int32_t
+Ice::ObjectPrx::ice_getConnectionPoolSize() const
+{
+    return _reference->getConnectionPoolSize();
+}
+
 EndpointSelectionType
 Ice::ObjectPrx::ice_getEndpointSelection() const
 {
@@ -387,6 +393,25 @@ Ice::ObjectPrx::_connectionId(const string& id) const
     }
 }
 
+ReferencePtr
+Ice::ObjectPrx::_connectionPoolSize(int32_t newSize) const
+{
+    if (newSize < 1)
+    {
+        ostringstream s;
+        s << "invalid value passed to ice_connectionPoolSize: " << newSize;
+        throw invalid_argument(s.str());
+    }
+    if (newSize == _reference->getConnectionPoolSize())
+    {
+        return _reference;
+    }
+    else
+    {
+        return _reference->changeConnectionPoolSize(newSize);
+    }
+}
+
 ReferencePtr
 Ice::ObjectPrx::_context(const Context& newContext) const
 {
@@ -12,6 +12,7 @@
 #include "Ice/OutputStream.h"
 #include "Ice/InputStream.h"
 #include "ConnectionI.h"
+#include "ReplyStatus.h"
 
 using namespace std;
 using namespace Ice;
@@ -28,6 +29,12 @@ const string ice_invoke_name = "ice_invoke";
 const string ice_getConnection_name = "ice_getConnection";
 const string ice_flushBatchRequests_name = "ice_flushBatchRequests";
 
+//
+// The minimum size of the in-parameters of a synchronous ice_invoke for the request
+// to reference them instead of copying them.
+//
+const ptrdiff_t borrowedSizeMin = 64 * 1024;
+
 }
 
 namespace IceInternal
@@ -165,6 +172,16 @@ public:
             {
                 _os.writeEmptyEncapsulation(_encoding);
             }
+            else if(_synchronous && inParams.second - inParams.first >= borrowedSizeMin &&
+                    !_proxy._getReference()->isBatch())
+            {
+                //
+                // The caller waits for the invocation to complete, the request can reference
+                // the in-parameters until it's sent. The connection copies them if the request
+                // is canceled while being sent.
+                //
+                _os.writeBorrowed(inParams.first, inParams.second);
+            }
             else
             {
                 _os.writeEncapsulation(inParams.first, static_cast<std::int32_t>(inParams.second - inParams.first));
@@ -210,6 +227,91 @@ public:
     }
 };
 
+//
+// Forwards an encoded request, the request is written after the request header
+// and the reply is provided to the response callback without being decoded.
+//
+class ForwardLambdaOutgoing : public OutgoingAsync, public LambdaInvoke
+{
+public:
+
+    ForwardLambdaOutgoing(Ice::ObjectPrx proxy,
+                          std::function<void(std::pair<const Ice::Byte*, const Ice::Byte*>)> response,
+                          std::function<void(std::exception_ptr)> ex,
+                          std::function<void(bool)> sent) :
+        OutgoingAsync(std::move(proxy), false), LambdaInvoke(std::move(ex), std::move(sent))
+    {
+        if(response)
+        {
+            _response = [this, response = std::move(response)](bool)
+            {
+                response({ _is.i, _is.b.end() });
+            };
+        }
+    }
+
+    void
+    invoke(const std::pair<const Ice::Byte*, const Ice::Byte*>& request, const Ice::Current& current)
+    {
+        if(_proxy._getReference()->isBatch())
+        {
+            ProxyOutgoingAsyncBase::abort(make_exception_ptr(
+                FeatureNotSupportedException(__FILE__, __LINE__, "request forwarding with a batch proxy")));
+            return;
+        }
+
+        try
+        {
+            checkSupportedProtocol(getCompatibleProtocol(_proxy._getReference()->getProtocol()));
+
+            _mode = current.mode;
+            _observer.attach(_proxy, current.operation, current.ctx);
+            _os.writeBlob(requestHdr, sizeof(requestHdr));
+            _os.writeBlob(request.first, static_cast<size_t>(request.second - request.first));
+            OutgoingAsync::invoke(current.operation);
+        }
+        catch (const std::exception&)
+        {
+            abort(std::current_exception());
+        }
+    }
+
+    virtual bool response() override
+    {
+        //
+        // NOTE: this method is called from ConnectionI.parseMessage
+        // with the connection locked. Therefore, it must not invoke
+        // any user callbacks.
+        //
+        if(_is.i == _is.b.end())
+        {
+            return OutgoingAsync::response(); // Raises UnmarshalOutOfBoundsException
+        }
+
+        //
+        // The *NotExist replies are decoded and raised as exceptions, the request
+        // might be retried, for example after clearing the locator cache of an
+        // indirect proxy or adding the proxy to the router.
+        //
+        if(*_is.i == replyObjectNotExist || *_is.i == replyFacetNotExist || *_is.i == replyOperationNotExist)
+        {
+            return OutgoingAsync::response();
+        }
+
+        if(_childObserver)
+        {
+            _childObserver->reply(static_cast<int32_t>(_is.b.size() - headerSize - 4));
+            _childObserver.detach();
+        }
+
+        if(*_is.i == replyUserException)
+        {
+            _observer.userException();
+        }
+        return responseImpl(true, true);
+    }
+};
+
 template<typename R>
 class InvokePromiseOutgoing : public InvokeOutgoingAsyncT<R>, public PromiseInvoke<R>
 {
@@ -567,6 +669,20 @@ Ice::ObjectPrx::ice_invokeAsync(const string &operation,
     { outAsync->cancel(); };
 }
 
+std::function<void()>
+Ice::ObjectPrx::ice_forwardAsync(const std::pair<const Ice::Byte*, const Ice::Byte*>& request,
+                                 std::function<void(std::pair<const Ice::Byte*, const Ice::Byte*>)> response,
+                                 std::function<void(std::exception_ptr)> ex,
+                                 std::function<void(bool)> sent,
+                                 const Ice::Current& current) const
+{
+    auto outAsync = std::make_shared<ForwardLambdaOutgoing>(*this, std::move(response), std::move(ex),
+                                                            std::move(sent));
+    outAsync->invoke(request, current);
+    return [outAsync]()
+    { outAsync->cancel(); };
+}
+
 std::shared_ptr<Ice::Connection>
 Ice::ObjectPrx::ice_getConnection() const
 {
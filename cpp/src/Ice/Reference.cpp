@@ -23,6 +23,7 @@
 #include "FixedRequestHandler.h"
 #include "ObjectAdapterFactory.h"
 #include <Ice/DefaultsAndOverrides.h>
+#include <Ice/EndpointStats.h>
 #include <Ice/Comparable.h>
 #include <Ice/StringUtil.h>
 
@@ -552,6 +553,12 @@ IceInternal::FixedReference::getCacheConnection() const
     return true;
 }
 
+int
+IceInternal::FixedReference::getConnectionPoolSize() const
+{
+    return 1;
+}
+
 bool
 IceInternal::FixedReference::getPreferSecure() const
 {
@@ -618,6 +625,12 @@ IceInternal::FixedReference::changeCacheConnection(bool) const
     throw FixedProxyException(__FILE__, __LINE__);
 }
 
+ReferencePtr
+IceInternal::FixedReference::changeConnectionPoolSize(int) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+}
+
 ReferencePtr
 IceInternal::FixedReference::changePreferSecure(bool) const
 {
@@ -821,6 +834,7 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout,
                                                   int invocationTimeout,
+                                                  int connectionPoolSize,
                                                   const Ice::Context& ctx) :
     Reference(instance, communicator, id, facet, mode, secure, protocol, encoding, invocationTimeout, ctx),
     _endpoints(endpoints),
@@ -829,6 +843,7 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
     _routerInfo(routerInfo),
     _collocationOptimized(collocationOptimized),
     _cacheConnection(cacheConnection),
+    _connectionPoolSize(connectionPoolSize),
     _preferSecure(preferSecure),
     _endpointSelection(endpointSelection),
     _locatorCacheTimeout(locatorCacheTimeout),
@@ -875,6 +890,12 @@ IceInternal::RoutableReference::getCacheConnection() const
     return _cacheConnection;
 }
 
+int
+IceInternal::RoutableReference::getConnectionPoolSize() const
+{
+    return _connectionPoolSize;
+}
+
 bool
 IceInternal::RoutableReference::getPreferSecure() const
 {
@@ -1000,6 +1021,14 @@ IceInternal::RoutableReference::changeCacheConnection(bool newCache) const
     return r;
 }
 
+ReferencePtr
+IceInternal::RoutableReference::changeConnectionPoolSize(int newSize) const
+{
+    RoutableReferencePtr r = dynamic_pointer_cast<RoutableReference>(clone());
+    r->_connectionPoolSize = newSize;
+    return r;
+}
+
 ReferencePtr
 IceInternal::RoutableReference::changePreferSecure(bool newPreferSecure) const
 {
@@ -1171,8 +1200,31 @@ IceInternal::RoutableReference::toProperty(const string& prefix) const
     properties[prefix] = toString();
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
+    if(_connectionPoolSize != 1)
+    {
+        ostringstream s;
+        s << _connectionPoolSize;
+        properties[prefix + ".ConnectionPoolSize"] = s.str();
+    }
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-    properties[prefix + ".EndpointSelection"] = _endpointSelection == EndpointSelectionType::Random ? "Random" : "Ordered";
+    switch(_endpointSelection)
+    {
+        case EndpointSelectionType::Random:
+        {
+            properties[prefix + ".EndpointSelection"] = "Random";
+            break;
+        }
+        case EndpointSelectionType::Ordered:
+        {
+            properties[prefix + ".EndpointSelection"] = "Ordered";
+            break;
+        }
+        case EndpointSelectionType::Adaptive:
+        {
+            properties[prefix + ".EndpointSelection"] = "Adaptive";
+            break;
+        }
+    }
     {
         ostringstream s;
         s << _locatorCacheTimeout;
@@ -1240,6 +1292,10 @@ IceInternal::RoutableReference::operator==(const Reference& r) const
     {
         return false;
     }
+    if(_connectionPoolSize != rhs->_connectionPoolSize)
+    {
+        return false;
+    }
     if(_endpointSelection != rhs->_endpointSelection)
     {
         return false;
@@ -1329,6 +1385,14 @@ IceInternal::RoutableReference::operator<(const Reference& r) const
     {
         return false;
     }
+    if(_connectionPoolSize < rhs->_connectionPoolSize)
+    {
+        return true;
+    }
+    else if(rhs->_connectionPoolSize < _connectionPoolSize)
+    {
+        return false;
+    }
     if(_endpointSelection < rhs->_endpointSelection)
     {
         return true;
@@ -1601,7 +1665,11 @@ IceInternal::RoutableReference::createConnectionAsync(
         response(std::move(connection), compress);
     };
 
-    if(getCacheConnection() || endpoints.size() == 1)
+    //
+    // With the adaptive endpoint selection, the connection to the endpoint with the lowest cost is used or created
+    // even if there's an existing connection to another endpoint.
+    //
+    if((getCacheConnection() && getEndpointSelection() != EndpointSelectionType::Adaptive) || endpoints.size() == 1)
     {
         // Get an existing connection or create one if there's no existing connection to one of the given endpoints.
         factory->createAsync(
@@ -1625,11 +1693,13 @@ IceInternal::RoutableReference::createConnectionAsync(
                 vector<EndpointIPtr> endpoints,
                 OutgoingConnectionFactoryPtr factory,
                 EndpointSelectionType endpointSelection,
+                EndpointStatsTablePtr endpointStats,
                 function<void(Ice::ConnectionIPtr, bool)> createConnectionSucceded,
                 function<void(exception_ptr)> exception) :
                 _endpoints(std::move(endpoints)),
                 _factory(std::move(factory)),
                 _endpointSelection(endpointSelection),
+                _endpointStats(std::move(endpointStats)),
                 _createConnectionSucceded(std::move(createConnectionSucceded)),
                 _createConnectionFailed(std::move(exception))
             {
@@ -1652,6 +1722,11 @@ IceInternal::RoutableReference::createConnectionAsync(
                     _exception = ex;
                 }
 
+                if (_endpointStats)
+                {
+                    _endpointStats->get(_endpoints[_endpointIndex])->connectFailed();
+                }
+
                 if (++_endpointIndex == _endpoints.size())
                 {
                     _createConnectionFailed(_exception);
@@ -1674,6 +1749,7 @@ IceInternal::RoutableReference::createConnectionAsync(
             vector<EndpointIPtr> _endpoints;
             OutgoingConnectionFactoryPtr _factory;
             EndpointSelectionType _endpointSelection;
+            EndpointStatsTablePtr _endpointStats;
             std::function<void(Ice::ConnectionIPtr, bool)> _createConnectionSucceded;
             std::function<void(exception_ptr)> _createConnectionFailed;
         };
@@ -1682,6 +1758,7 @@ IceInternal::RoutableReference::createConnectionAsync(
             std::move(endpoints),
             std::move(factory),
             getEndpointSelection(),
+            getEndpointSelection() == EndpointSelectionType::Adaptive ? getInstance()->endpointStatsTable() : nullptr,
             std::move(createConnectionSucceded),
             std::move(exception));
         state->createAsync();
@@ -1713,6 +1790,7 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     _routerInfo(r._routerInfo),
     _collocationOptimized(r._collocationOptimized),
     _cacheConnection(r._cacheConnection),
+    _connectionPoolSize(r._connectionPoolSize),
     _preferSecure(r._preferSecure),
     _endpointSelection(r._endpointSelection),
     _locatorCacheTimeout(r._locatorCacheTimeout),
@@ -1782,6 +1860,13 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
             // Nothing to do.
             break;
         }
+        case EndpointSelectionType::Adaptive:
+        {
+            // Shuffle first so that the endpoints with the same cost are used in a random order.
+            IceUtilInternal::shuffle(endpoints.begin(), endpoints.end());
+            getInstance()->endpointStatsTable()->sort(endpoints);
+            break;
+        }
         default:
         {
             assert(false);
@@ -73,6 +73,7 @@ public:
     virtual RouterInfoPtr getRouterInfo() const { return 0; }
     virtual bool getCollocationOptimized() const = 0;
     virtual bool getCacheConnection() const = 0;
+    virtual int getConnectionPoolSize() const = 0;
     virtual bool getPreferSecure() const = 0;
     virtual Ice::EndpointSelectionType getEndpointSelection() const = 0;
     virtual int getLocatorCacheTimeout() const = 0;
@@ -100,6 +101,7 @@ public:
     virtual ReferencePtr changeCollocationOptimized(bool) const = 0;
     virtual ReferencePtr changeLocatorCacheTimeout(int) const = 0;
     virtual ReferencePtr changeCacheConnection(bool) const = 0;
+    virtual ReferencePtr changeConnectionPoolSize(int) const = 0;
     virtual ReferencePtr changePreferSecure(bool) const = 0;
     virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const = 0;
 
@@ -190,6 +192,7 @@ public:
     std::string getAdapterId() const final;
     bool getCollocationOptimized() const final;
     bool getCacheConnection() const final;
+    int getConnectionPoolSize() const final;
     bool getPreferSecure() const final;
     Ice::EndpointSelectionType getEndpointSelection() const final;
     int getLocatorCacheTimeout() const final;
@@ -202,6 +205,7 @@ public:
     ReferencePtr changeRouter(const std::optional<Ice::RouterPrx>&) const final;
     ReferencePtr changeCollocationOptimized(bool) const final;
     ReferencePtr changeCacheConnection(bool) const final;
+    ReferencePtr changeConnectionPoolSize(int) const final;
     ReferencePtr changePreferSecure(bool) const final;
     ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const final;
     ReferencePtr changeLocatorCacheTimeout(int) const final;
@@ -238,7 +242,7 @@ public:
     RoutableReference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode,
                       bool, const Ice::ProtocolVersion&, const Ice::EncodingVersion&, const std::vector<EndpointIPtr>&,
                       const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool,
-                      Ice::EndpointSelectionType, int, int, const Ice::Context&);
+                      Ice::EndpointSelectionType, int, int, int, const Ice::Context&);
 
     RoutableReference(const RoutableReference&);
 
@@ -248,6 +252,7 @@ public:
     RouterInfoPtr getRouterInfo() const final;
     bool getCollocationOptimized() const final;
     bool getCacheConnection() const final;
+    int getConnectionPoolSize() const final;
     bool getPreferSecure() const final;
     Ice::EndpointSelectionType getEndpointSelection() const final;
     int getLocatorCacheTimeout() const final;
@@ -263,6 +268,7 @@ public:
     ReferencePtr changeRouter(const std::optional<Ice::RouterPrx>&) const final;
     ReferencePtr changeCollocationOptimized(bool) const final;
     ReferencePtr changeCacheConnection(bool) const final;
+    ReferencePtr changeConnectionPoolSize(int) const final;
     ReferencePtr changePreferSecure(bool) const final;
     ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const final;
     ReferencePtr changeLocatorCacheTimeout(int) const final;
@@ -321,6 +327,7 @@ private:
     RouterInfoPtr _routerInfo; // Null if no router is used.
     bool _collocationOptimized;
     bool _cacheConnection;
+    int _connectionPoolSize;
     bool _preferSecure;
     Ice::EndpointSelectionType _endpointSelection;
     int _locatorCacheTimeout;
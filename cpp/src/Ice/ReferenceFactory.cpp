@@ -632,6 +632,7 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
     {
         "EndpointSelection",
         "ConnectionCached",
+        "ConnectionPoolSize",
         "PreferSecure",
         "LocatorCacheTimeout",
         "InvocationTimeout",
@@ -719,6 +720,7 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     Ice::EndpointSelectionType endpointSelection = defaultsAndOverrides->defaultEndpointSelection;
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
     int invocationTimeout = defaultsAndOverrides->defaultInvocationTimeout;
+    int connectionPoolSize = defaultsAndOverrides->defaultConnectionPoolSize;
     Ice::Context ctx;
 
     //
@@ -785,10 +787,14 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             {
                 endpointSelection = EndpointSelectionType::Ordered;
             }
+            else if(type == "Adaptive")
+            {
+                endpointSelection = EndpointSelectionType::Adaptive;
+            }
             else
             {
                 throw EndpointSelectionTypeParseException(__FILE__, __LINE__, "illegal value `" + type +
-                                                          "'; expected `Random' or `Ordered'");
+                                                          "'; expected `Random', `Ordered' or `Adaptive'");
             }
         }
 
@@ -822,6 +828,21 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             }
         }
 
+        property = propertyPrefix + ".ConnectionPoolSize";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            connectionPoolSize = properties->getPropertyAsIntWithDefault(property, connectionPoolSize);
+            if(connectionPoolSize < 1)
+            {
+                connectionPoolSize = 1;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 1";
+            }
+        }
+
         property = propertyPrefix + ".Context.";
         PropertyDict contexts = properties->getPropertiesForPrefix(property);
         for(PropertyDict::const_iterator p = contexts.begin(); p != contexts.end(); ++p)
@@ -852,5 +873,6 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
         endpointSelection,
         locatorCacheTimeout,
         invocationTimeout,
+        connectionPoolSize,
         ctx);
 }
@@ -205,36 +205,61 @@ checkRetryAfterException(std::exception_ptr ex, const ReferencePtr& ref, int& cn
     return interval;
 }
 
+vector<ReferencePtr>
+createPool(const ReferencePtr& reference)
+{
+    vector<ReferencePtr> pool { reference };
+    if (reference->isTwoway())
+    {
+        //
+        // The connections of the pool are obtained with distinct connection IDs derived from the
+        // connection ID of the reference, the outgoing connection factory never shares connections
+        // with different connection IDs.
+        //
+        for (int i = 1; i < reference->getConnectionPoolSize(); ++i)
+        {
+            pool.push_back(reference->changeConnectionId(reference->getConnectionId() + "/pool" + to_string(i)));
+        }
+    }
+    return pool;
+}
+
 }
 
 RequestHandlerCache::RequestHandlerCache(const ReferencePtr& reference) :
     _reference(reference),
-    _cacheConnection(reference->getCacheConnection())
+    // With the adaptive endpoint selection, the connection is selected for each invocation.
+    _cacheConnection(reference->getCacheConnection() &&
+                     reference->getEndpointSelection() != EndpointSelectionType::Adaptive),
+    _pool(createPool(reference)),
+    _nextPoolIndex(0),
+    _cachedRequestHandlers(_pool.size())
 {
 }
 
 IceInternal::RequestHandlerPtr
 RequestHandlerCache::getRequestHandler()
 {
+    size_t index = nextPoolIndex();
     if (_cacheConnection)
     {
         lock_guard<mutex> lock(_mutex);
-        if (_cachedRequestHandler)
+        if (_cachedRequestHandlers[index])
         {
-            return _cachedRequestHandler;
+            return _cachedRequestHandlers[index];
         }
     }
 
-    auto handler = _reference->getRequestHandler();
+    auto handler = _pool[index]->getRequestHandler();
     if (_cacheConnection)
     {
         lock_guard<mutex> lock(_mutex);
-        if (!_cachedRequestHandler)
+        if (!_cachedRequestHandlers[index])
         {
-            _cachedRequestHandler = handler;
+            _cachedRequestHandlers[index] = handler;
         }
         // else discard handler
-        return _cachedRequestHandler;
+        return _cachedRequestHandlers[index];
     }
     else
     {
@@ -250,7 +275,7 @@ RequestHandlerCache::getCachedConnection()
         RequestHandlerPtr handler;
         {
             lock_guard<mutex> lock(_mutex);
-            handler = _cachedRequestHandler;
+            handler = _cachedRequestHandlers[0];
         }
         if (handler)
         {
@@ -266,9 +291,12 @@ RequestHandlerCache::clearCachedRequestHandler(const RequestHandlerPtr& handler)
     if (_cacheConnection)
     {
         lock_guard<mutex> lock(_mutex);
-        if (handler == _cachedRequestHandler)
+        for (auto& cachedRequestHandler : _cachedRequestHandlers)
         {
-            _cachedRequestHandler = nullptr;
+            if (handler == cachedRequestHandler)
+            {
+                cachedRequestHandler = nullptr;
+            }
         }
     }
 }
@@ -330,3 +358,9 @@ RequestHandlerCache::handleException(
         return 0;
     }
 }
+
+size_t
+RequestHandlerCache::nextPoolIndex()
+{
+    return _pool.size() == 1 ? 0 : _nextPoolIndex++ % _pool.size();
+}
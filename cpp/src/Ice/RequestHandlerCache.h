@@ -8,13 +8,19 @@
 #include "Ice/OperationMode.h"
 #include "Ice/ConnectionF.h"
 #include "RequestHandler.h"
+#include <atomic>
 #include <mutex>
+#include <vector>
 
 namespace IceInternal
 {
 
 // Represents a holder/cache for a request handler. It's tied to a single Reference, and can be shared by multiple
 // proxies (all with the same Reference).
+//
+// When the connection pool size of the reference is greater than 1, twoway invocations are spread round-robin over
+// the connections of the pool, each one using its own request handler. The other invocation modes always use the
+// first connection of the pool to preserve the ordering of the requests.
 class RequestHandlerCache final
 {
 public:
@@ -36,10 +42,15 @@ public:
 
 private:
 
+    size_t nextPoolIndex();
+
     const ReferencePtr _reference;
     const bool _cacheConnection;
-    std::mutex _mutex; // protects _cachedRequestHandler
-    RequestHandlerPtr _cachedRequestHandler; // set only when _cacheConnection is true.
+    const std::vector<ReferencePtr> _pool; // The references of the connection pool, starting with _reference.
+    std::atomic<size_t> _nextPoolIndex;
+    std::mutex _mutex; // protects _cachedRequestHandlers
+    std::vector<RequestHandlerPtr> _cachedRequestHandlers; // One per pool reference, used only when _cacheConnection
+                                                           // is true.
 };
 
 }
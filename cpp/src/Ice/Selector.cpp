@@ -23,6 +23,59 @@ using namespace IceInternal;
 namespace
 {
 struct timespec zeroTimeout = { 0, 0 };
+}
+#elif defined(ICE_USE_IO_URING)
+#   include <Ice/TraceLevels.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   include <endian.h>
+
+namespace
+{
+
+const unsigned ringEntries = 1024;
+
+int
+ioUringSetup(unsigned entries, struct io_uring_params* params)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int
+ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, void* arg, size_t argSize)
+{
+    return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+}
+
+void*
+mapRing(int fd, size_t size, off_t offset)
+{
+    void* p = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    if(p == MAP_FAILED)
+    {
+        throw Ice::SocketException(__FILE__, __LINE__, IceInternal::getSocketErrno());
+    }
+    return p;
+}
+
+unsigned
+toPollEvents(SocketOperation status)
+{
+    unsigned events = 0;
+    if(status & SocketOperationRead)
+    {
+        events |= POLLIN;
+    }
+    if(status & SocketOperationWrite)
+    {
+        events |= POLLOUT;
+    }
+#if __BYTE_ORDER == __BIG_ENDIAN
+    events = (events << 16) | (events >> 16); // The kernel expects the 16 bits halves swapped.
+#endif
+    return events;
+}
+
 }
 #endif
 
@@ -185,20 +238,34 @@ Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrup
 
 #if defined(ICE_USE_EPOLL)
     _events.resize(256);
-    _queueFd = epoll_create(1);
-    if(_queueFd < 0)
+#   if defined(ICE_USE_IO_URING)
+    _ioUring = setupRing();
+    if(_ioUring)
     {
-        throw Ice::SocketException(__FILE__, __LINE__, IceInternal::getSocketErrno());
+        _interruptPoll.handler = 0;
+        _interruptPoll.fd = _fdIntrRead;
+        _interruptPoll.status = SocketOperationRead;
+        addPoll(&_interruptPoll);
+        _interruptPollArmed = true;
     }
-
-    epoll_event event;
-    memset(&event, 0, sizeof(epoll_event));
-    event.data.ptr = 0;
-    event.events = EPOLLIN;
-    if(epoll_ctl(_queueFd, EPOLL_CTL_ADD, _fdIntrRead, &event) != 0)
+    else
+#   endif
     {
-        Ice::Error out(_instance->initializationData().logger);
-        out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+        _queueFd = epoll_create(1);
+        if(_queueFd < 0)
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, IceInternal::getSocketErrno());
+        }
+
+        epoll_event event;
+        memset(&event, 0, sizeof(epoll_event));
+        event.data.ptr = 0;
+        event.events = EPOLLIN;
+        if(epoll_ctl(_queueFd, EPOLL_CTL_ADD, _fdIntrRead, &event) != 0)
+        {
+            Ice::Error out(_instance->initializationData().logger);
+            out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+        }
     }
 #elif defined(ICE_USE_KQUEUE)
     _events.resize(256);
@@ -244,6 +311,29 @@ Selector::destroy()
     }
 #endif
 
+#if defined(ICE_USE_IO_URING)
+    if(_ioUring)
+    {
+        munmap(_sqes, _sqesSize);
+        if(_cqRing != _sqRing)
+        {
+            munmap(_cqRing, _cqRingSize);
+        }
+        munmap(_sqRing, _sqRingSize);
+
+        for(map<EventHandler*, Poll*>::const_iterator p = _polls.begin(); p != _polls.end(); ++p)
+        {
+            delete p->second;
+        }
+        _polls.clear();
+        for(set<Poll*>::const_iterator p = _removedPolls.begin(); p != _removedPolls.end(); ++p)
+        {
+            delete *p;
+        }
+        _removedPolls.clear();
+    }
+#endif
+
     try
     {
         closeSocket(_fdIntrWrite);
@@ -303,6 +393,13 @@ Selector::enable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+        if(_ioUring)
+        {
+            updatePoll(handler);
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation previous = static_cast<SocketOperation>(handler->_registered & ~(handler->_disabled | status));
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
@@ -357,6 +454,13 @@ Selector::disable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+        if(_ioUring)
+        {
+            updatePoll(handler);
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
         epoll_event event;
@@ -496,7 +600,30 @@ Selector::startSelect()
         _interrupted = false;
     }
 
-#if !defined(ICE_USE_EPOLL)
+#if defined(ICE_USE_IO_URING)
+    if(_ioUring)
+    {
+        //
+        // Re-arm the polls of the handlers returned by the previous select.
+        //
+        for(vector<EventHandler*>::const_iterator p = _rearm.begin(); p != _rearm.end(); ++p)
+        {
+            map<EventHandler*, Poll*>::iterator q = _polls.find(*p);
+            if(q != _polls.end() && !q->second)
+            {
+                _polls.erase(q);
+                updatePoll(*p);
+            }
+        }
+        _rearm.clear();
+
+        if(!_interruptPollArmed)
+        {
+            addPoll(&_interruptPoll);
+            _interruptPollArmed = true;
+        }
+    }
+#elif !defined(ICE_USE_EPOLL)
     if(!_changes.empty())
     {
         updateSelector();
@@ -534,12 +661,56 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation> >& handlers)
         pair<EventHandler*, SocketOperation> p;
 
 #if defined(ICE_USE_EPOLL)
-        struct epoll_event& ev = _events[i];
-        p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
-        p.second = static_cast<SocketOperation>(((ev.events & (EPOLLIN | EPOLLERR)) ?
-                                                 SocketOperationRead : SocketOperationNone) |
-                                                ((ev.events & (EPOLLOUT | EPOLLERR)) ?
-                                                 SocketOperationWrite : SocketOperationNone));
+#   if defined(ICE_USE_IO_URING)
+        if(_ioUring)
+        {
+            struct io_uring_cqe& cqe = _completions[static_cast<size_t>(i)];
+            Poll* poll = reinterpret_cast<Poll*>(static_cast<uintptr_t>(cqe.user_data));
+            if(!poll)
+            {
+                continue; // Completion of a poll removal.
+            }
+            else if(poll == &_interruptPoll)
+            {
+                _interruptPollArmed = false;
+                continue; // Interrupted
+            }
+            else if(!poll->handler)
+            {
+                _removedPolls.erase(poll);
+                delete poll;
+                continue;
+            }
+
+            p.first = poll->handler;
+            if(cqe.res < 0)
+            {
+                p.second = poll->status; // Let the handler report the error.
+            }
+            else
+            {
+                p.second = static_cast<SocketOperation>(((cqe.res & (POLLIN | POLLERR | POLLHUP)) ?
+                                                         SocketOperationRead : SocketOperationNone) |
+                                                        ((cqe.res & (POLLOUT | POLLERR | POLLHUP)) ?
+                                                         SocketOperationWrite : SocketOperationNone));
+            }
+
+            map<EventHandler*, Poll*>::iterator r = _polls.find(poll->handler);
+            assert(r != _polls.end() && r->second == poll);
+            r->second = 0;
+            _rearm.push_back(poll->handler);
+            delete poll;
+        }
+        else
+#   endif
+        {
+            struct epoll_event& ev = _events[i];
+            p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
+            p.second = static_cast<SocketOperation>(((ev.events & (EPOLLIN | EPOLLERR)) ?
+                                                     SocketOperationRead : SocketOperationNone) |
+                                                    ((ev.events & (EPOLLOUT | EPOLLERR)) ?
+                                                     SocketOperationWrite : SocketOperationNone));
+        }
 #elif defined(ICE_USE_KQUEUE)
         struct kevent& ev = _events[static_cast<size_t>(i)];
         if(ev.flags & EV_ERROR)
@@ -650,7 +821,37 @@ Selector::select(int timeout)
     while(true)
     {
 #if defined(ICE_USE_EPOLL)
-        _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+#   if defined(ICE_USE_IO_URING)
+        if(_ioUring)
+        {
+            //
+            // Submit the queued poll requests and wait for completions with a single system call.
+            //
+            unsigned toSubmit = __atomic_load_n(_sqTail, __ATOMIC_ACQUIRE) - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+            struct __kernel_timespec ts;
+            struct io_uring_getevents_arg arg;
+            memset(&arg, 0, sizeof(arg));
+            if(timeout >= 0)
+            {
+                ts.tv_sec = timeout / 1000;
+                ts.tv_nsec = (timeout % 1000) * 1000000;
+                arg.ts = reinterpret_cast<uintptr_t>(&ts);
+            }
+            if(ioUringEnter(_queueFd, toSubmit, timeout == 0 ? 0 : 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                            &arg, sizeof(arg)) == SOCKET_ERROR && errno != ETIME && errno != EBUSY)
+            {
+                _count = SOCKET_ERROR;
+            }
+            else
+            {
+                _count = getCompletions();
+            }
+        }
+        else
+#   endif
+        {
+            _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+        }
 #elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
         if(timeout >= 0)
@@ -862,6 +1063,14 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
                                         ICE_MAYBE_UNUSED SocketOperation add)
 {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_USE_IO_URING)
+    if(_ioUring)
+    {
+        updatePoll(handler);
+        checkReady(handler);
+        return;
+    }
+#   endif
     SocketOperation previous = handler->_registered;
     previous = static_cast<SocketOperation>(previous & ~add);
     previous = static_cast<SocketOperation>(previous | remove);
@@ -946,6 +1155,239 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
     checkReady(handler);
 }
 
+#if defined(ICE_USE_IO_URING)
+
+bool
+Selector::setupRing()
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    _queueFd = ioUringSetup(ringEntries, &params);
+    if(_queueFd < 0 || !(params.features & IORING_FEAT_EXT_ARG))
+    {
+        //
+        // io_uring isn't supported (Linux older than 5.11) or it isn't permitted (seccomp
+        // filter or io_uring disabled with the kernel.io_uring_disabled sysctl).
+        //
+        string error = _queueFd < 0 ? IceUtilInternal::errorToString(IceInternal::getSocketErrno()) :
+            "IORING_FEAT_EXT_ARG isn't supported";
+        if(_queueFd >= 0)
+        {
+            closeSocketNoThrow(_queueFd);
+        }
+        if(_instance->traceLevels()->network >= 1)
+        {
+            Ice::Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "io_uring is not available, using epoll:\n" << error;
+        }
+        return false;
+    }
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _sqRingSize = _cqRingSize = max(_sqRingSize, _cqRingSize);
+    }
+    _sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    _sqRing = 0;
+    _cqRing = 0;
+    _sqes = 0;
+    try
+    {
+        _sqRing = mapRing(_queueFd, _sqRingSize, IORING_OFF_SQ_RING);
+        _cqRing = params.features & IORING_FEAT_SINGLE_MMAP ? _sqRing :
+            mapRing(_queueFd, _cqRingSize, IORING_OFF_CQ_RING);
+        _sqes = static_cast<struct io_uring_sqe*>(mapRing(_queueFd, _sqesSize, IORING_OFF_SQES));
+    }
+    catch(const Ice::SocketException& ex)
+    {
+        if(_cqRing && _cqRing != _sqRing)
+        {
+            munmap(_cqRing, _cqRingSize);
+        }
+        if(_sqRing)
+        {
+            munmap(_sqRing, _sqRingSize);
+        }
+        closeSocketNoThrow(_queueFd);
+        if(_instance->traceLevels()->network >= 1)
+        {
+            Ice::Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "io_uring is not available, using epoll:\n" << ex;
+        }
+        return false;
+    }
+
+    char* sq = static_cast<char*>(_sqRing);
+    _sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    _sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    _sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    _sqEntries = params.sq_entries;
+    unsigned* sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    for(unsigned i = 0; i < _sqEntries; ++i)
+    {
+        sqArray[i] = i; // Submission queue entries are always used in order.
+    }
+
+    char* cq = static_cast<char*>(_cqRing);
+    _cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    _cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    _cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    _completions.resize(256);
+    return true;
+}
+
+void
+Selector::updatePoll(EventHandler* handler)
+{
+    NativeInfoPtr nativeInfo = handler->getNativeInfo();
+    SOCKET fd = nativeInfo ? nativeInfo->fd() : INVALID_SOCKET;
+    SocketOperation status = SocketOperationNone;
+    if(fd != INVALID_SOCKET)
+    {
+        status = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled &
+                                              (SocketOperationRead | SocketOperationWrite));
+    }
+
+    map<EventHandler*, Poll*>::iterator p = _polls.find(handler);
+    if(p != _polls.end())
+    {
+        if(!p->second)
+        {
+            //
+            // The poll completed, it's re-armed by startSelect() with the handler status.
+            //
+            if(!status)
+            {
+                _polls.erase(p);
+            }
+            return;
+        }
+        else if(p->second->fd == fd && p->second->status == status)
+        {
+            return;
+        }
+
+        removePoll(p->second);
+        if(!status)
+        {
+            _polls.erase(p);
+            return;
+        }
+        p->second = new Poll { handler, fd, status };
+        addPoll(p->second);
+    }
+    else if(status)
+    {
+        Poll* poll = new Poll { handler, fd, status };
+        _polls.insert(make_pair(handler, poll));
+        addPoll(poll);
+    }
+}
+
+void
+Selector::addPoll(Poll* poll)
+{
+    struct io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = poll->fd;
+    sqe->poll32_events = toPollEvents(poll->status);
+    sqe->user_data = reinterpret_cast<uintptr_t>(poll);
+    queueSqe();
+}
+
+void
+Selector::removePoll(Poll* poll)
+{
+    //
+    // The poll is deleted by finishSelect() once its completion is received.
+    //
+    poll->handler = 0;
+    _removedPolls.insert(poll);
+
+    struct io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uintptr_t>(poll);
+    sqe->user_data = 0;
+    queueSqe();
+}
+
+struct io_uring_sqe*
+Selector::getSqe()
+{
+    unsigned tail = __atomic_load_n(_sqTail, __ATOMIC_RELAXED);
+    while(tail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) >= _sqEntries)
+    {
+        //
+        // The submission ring is full, submit the queued requests now.
+        //
+        if(!submit())
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, IceInternal::getSocketErrno());
+        }
+    }
+    struct io_uring_sqe* sqe = &_sqes[tail & _sqMask];
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    return sqe;
+}
+
+void
+Selector::queueSqe()
+{
+    __atomic_store_n(_sqTail, __atomic_load_n(_sqTail, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE);
+    if(_selecting && !submit())
+    {
+        //
+        // Submit the request now if another thread is waiting for completions, it would
+        // otherwise only be submitted by the next select.
+        //
+        Ice::Error out(_instance->initializationData().logger);
+        out << "error while updating selector:\n" << IceUtilInternal::errorToString(IceInternal::getSocketErrno());
+    }
+}
+
+bool
+Selector::submit()
+{
+    while(true)
+    {
+        unsigned toSubmit = __atomic_load_n(_sqTail, __ATOMIC_RELAXED) - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+        if(toSubmit == 0 || ioUringEnter(_queueFd, toSubmit, 0, 0, 0, 0) != SOCKET_ERROR)
+        {
+            return true;
+        }
+        else if(!interrupted() && errno != EAGAIN && errno != EBUSY)
+        {
+            return false;
+        }
+    }
+}
+
+int
+Selector::getCompletions()
+{
+    unsigned head = __atomic_load_n(_cqHead, __ATOMIC_RELAXED);
+    unsigned tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+    size_t count = tail - head;
+    if(_completions.size() < count)
+    {
+        _completions.resize(count);
+    }
+    for(size_t i = 0; i < count; ++i)
+    {
+        _completions[i] = _cqes[(head + i) & _cqMask];
+    }
+    __atomic_store_n(_cqHead, tail, __ATOMIC_RELEASE);
+    return static_cast<int>(count);
+}
+
+#endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
@@ -14,6 +14,10 @@
 
 #if defined(ICE_USE_EPOLL)
 #   include <sys/epoll.h>
+#   if defined(ICE_USE_IO_URING)
+#      include <linux/io_uring.h>
+#      include <set>
+#   endif
 #elif defined(ICE_USE_KQUEUE)
 #   include <sys/event.h>
 #elif defined(ICE_USE_IOCP)
@@ -118,7 +122,55 @@ private:
 
 #if defined(ICE_USE_EPOLL)
     std::vector<struct epoll_event> _events;
-    int _queueFd;
+    int _queueFd; // The epoll FD or the io_uring FD.
+#   if defined(ICE_USE_IO_URING)
+    //
+    // The io_uring selector polls the sockets with one-shot poll requests, the reads
+    // and writes are still performed by the transceivers once the sockets are ready.
+    // A poll request is re-armed by startSelect() once the handler processed the ready
+    // operations. The requests are queued in the submission ring and submitted with
+    // the wait for completions, a single system call submits all the updates of the
+    // previous select. If the ring can't be set up, the selector uses epoll instead.
+    //
+    struct Poll
+    {
+        EventHandler* handler; // Null if the poll is removed.
+        SOCKET fd;
+        SocketOperation status;
+    };
+
+    bool setupRing();
+    void updatePoll(EventHandler*);
+    void addPoll(Poll*);
+    void removePoll(Poll*);
+    struct io_uring_sqe* getSqe();
+    void queueSqe();
+    bool submit();
+    int getCompletions();
+
+    bool _ioUring;
+    void* _sqRing;
+    size_t _sqRingSize;
+    void* _cqRing;
+    size_t _cqRingSize;
+    struct io_uring_sqe* _sqes;
+    size_t _sqesSize;
+    unsigned* _sqHead;
+    unsigned* _sqTail;
+    unsigned _sqMask;
+    unsigned _sqEntries;
+    unsigned* _cqHead;
+    unsigned* _cqTail;
+    unsigned _cqMask;
+    struct io_uring_cqe* _cqes;
+
+    std::vector<struct io_uring_cqe> _completions;
+    std::map<EventHandler*, Poll*> _polls; // The poll of each handler, null if it needs to be re-armed.
+    std::set<Poll*> _removedPolls;
+    std::vector<EventHandler*> _rearm;
+    Poll _interruptPoll;
+    bool _interruptPollArmed;
+#   endif
 #elif defined(ICE_USE_KQUEUE)
     std::vector<struct kevent> _events;
     std::vector<struct kevent> _changes;
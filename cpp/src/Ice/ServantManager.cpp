@@ -13,42 +13,29 @@ using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+IceInternal::ServantManager::ServantShard&
+IceInternal::ServantManager::shard(const Identity& ident) const
+{
+    return _shards[IdentityHash()(ident) % _shards.size()];
+}
+
 void
 IceInternal::ServantManager::addServant(const shared_ptr<Object>& object, const Identity& ident, const string& facet)
 {
-    lock_guard lock(_mutex);
-
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
+    ServantShard& s = shard(ident);
+    lock_guard lock(s.mutex);
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    FacetMap& facetMap = s.servantMapMap[ident];
+    if(!facetMap.insert(pair<const string, shared_ptr<Object>>(facet, object)).second)
     {
-        p = _servantMapMap.find(ident);
-    }
-
-    if(p == _servantMapMap.end())
-    {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
-    }
-    else
-    {
-        if(p->second.find(facet) != p->second.end())
+        ostringstream os;
+        os << Ice::identityToString(ident, _toStringMode);
+        if(!facet.empty())
         {
-            ToStringMode toStringMode = _instance->toStringMode();
-            ostringstream os;
-            os << Ice::identityToString(ident, toStringMode);
-            if(!facet.empty())
-            {
-                os << " -f " << escapeString(facet, "", toStringMode);
-            }
-            throw AlreadyRegisteredException(__FILE__, __LINE__, "servant", os.str());
+            os << " -f " << escapeString(facet, "", _toStringMode);
         }
+        throw AlreadyRegisteredException(__FILE__, __LINE__, "servant", os.str());
     }
-
-    _servantMapMapHint = p;
-
-    p->second.insert(pair<const string, shared_ptr<Object>>(facet, object));
 }
 
 void
@@ -58,13 +45,14 @@ IceInternal::ServantManager::addDefaultServant(const shared_ptr<Object>& object,
 
     assert(_instance); // Must not be called after destruction.
 
-    DefaultServantMap::iterator p = _defaultServantMap.find(category);
-    if(p != _defaultServantMap.end())
+    if(_defaultServantMap->find(category) != _defaultServantMap->end())
     {
         throw AlreadyRegisteredException(__FILE__, __LINE__, "default servant", category);
     }
 
-    _defaultServantMap.insert(pair<const string, shared_ptr<Object>>(category, object));
+    auto defaultServantMap = make_shared<DefaultServantMap>(*_defaultServantMap);
+    defaultServantMap->insert(pair<const string, shared_ptr<Object>>(category, object));
+    atomic_store(&_defaultServantMap, shared_ptr<const DefaultServantMap>(std::move(defaultServantMap)));
 }
 
 shared_ptr<Object>
@@ -77,26 +65,19 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
     //
     shared_ptr<Object> servant = 0;
 
-    lock_guard lock(_mutex);
+    ServantShard& s = shard(ident);
+    lock_guard lock(s.mutex);
 
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
     FacetMap::iterator q;
 
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
-
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(p == s.servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
-        ToStringMode toStringMode = _instance->toStringMode();
         ostringstream os;
-        os << Ice::identityToString(ident, toStringMode);
+        os << Ice::identityToString(ident, _toStringMode);
         if(!facet.empty())
         {
-            os << " -f " + escapeString(facet, "", toStringMode);
+            os << " -f " + escapeString(facet, "", _toStringMode);
         }
         throw NotRegisteredException(__FILE__, __LINE__, "servant", os.str());
     }
@@ -106,15 +87,7 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     if(p->second.empty())
     {
-        if(p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        s.servantMapMap.erase(p);
     }
     return servant;
 }
@@ -133,14 +106,17 @@ IceInternal::ServantManager::removeDefaultServant(const string& category)
 
     assert(_instance); // Must not be called after destruction.
 
-    DefaultServantMap::iterator p = _defaultServantMap.find(category);
-    if(p == _defaultServantMap.end())
+    DefaultServantMap::const_iterator p = _defaultServantMap->find(category);
+    if(p == _defaultServantMap->end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "default servant", category);
     }
 
     servant = p->second;
-    _defaultServantMap.erase(p);
+
+    auto defaultServantMap = make_shared<DefaultServantMap>(*_defaultServantMap);
+    defaultServantMap->erase(category);
+    atomic_store(&_defaultServantMap, shared_ptr<const DefaultServantMap>(std::move(defaultServantMap)));
 
     return servant;
 }
@@ -148,95 +124,62 @@ IceInternal::ServantManager::removeDefaultServant(const string& category)
 FacetMap
 IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 {
-    lock_guard lock(_mutex);
-
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    if(p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
-
-    if(p == _servantMapMap.end())
-    {
-        throw NotRegisteredException(__FILE__, __LINE__, "servant",
-                                     Ice::identityToString(ident, _instance->toStringMode()));
-    }
+    ServantShard& s = shard(ident);
+    lock_guard lock(s.mutex);
 
-    FacetMap result = p->second;
-
-    if(p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
+    ServantMapMap::iterator p = s.servantMapMap.find(ident);
+    if(p == s.servantMapMap.end())
     {
-        _servantMapMap.erase(p);
+        throw NotRegisteredException(__FILE__, __LINE__, "servant", Ice::identityToString(ident, _toStringMode));
     }
 
+    FacetMap result = std::move(p->second);
+    s.servantMapMap.erase(p);
     return result;
 }
 
 shared_ptr<Object>
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    lock_guard lock(_mutex);
-
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method might be called after destruction if the adapter dispatches
+    // incoming requests from bidir connections. Requests can be received over
+    // the bidir connection after the adapter was deactivated.
     //
-    //assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if(p == servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
-    }
+        ServantShard& s = shard(ident);
+        lock_guard lock(s.mutex);
 
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
-    {
-        DefaultServantMap::const_iterator d = _defaultServantMap.find(ident.category);
-        if(d == _defaultServantMap.end())
+        ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
+        if(p != s.servantMapMap.end())
         {
-            d = _defaultServantMap.find("");
-            if(d == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
+            FacetMap::const_iterator q = p->second.find(facet);
+            if(q != p->second.end())
             {
-                return d->second;
+                return q->second;
             }
         }
-        else
-        {
-            return d->second;
-        }
     }
-    else
+
+    shared_ptr<const DefaultServantMap> defaultServantMap = atomic_load(&_defaultServantMap);
+    DefaultServantMap::const_iterator d = defaultServantMap->find(ident.category);
+    if(d == defaultServantMap->end())
     {
-        _servantMapMapHint = p;
-        return q->second;
+        d = defaultServantMap->find("");
+        if(d == defaultServantMap->end())
+        {
+            return 0;
+        }
     }
+    return d->second;
 }
 
 shared_ptr<Object>
 IceInternal::ServantManager::findDefaultServant(const string& category) const
 {
-    lock_guard lock(_mutex);
-
-    DefaultServantMap::const_iterator p = _defaultServantMap.find(category);
-    if(p == _defaultServantMap.end())
+    shared_ptr<const DefaultServantMap> defaultServantMap = atomic_load(&_defaultServantMap);
+    DefaultServantMap::const_iterator p = defaultServantMap->find(category);
+    if(p == defaultServantMap->end())
     {
         return 0;
     }
@@ -249,26 +192,16 @@ IceInternal::ServantManager::findDefaultServant(const string& category) const
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    lock_guard lock(_mutex);
-
-    assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ServantShard& s = shard(ident);
+    lock_guard lock(s.mutex);
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
+    ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
+    if(p == s.servantMapMap.end())
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
         return p->second;
     }
 }
@@ -276,34 +209,16 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    lock_guard lock(_mutex);
-
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method might be called after destruction if the adapter dispatches
+    // incoming requests from bidir connections.
     //
-    //assert(_instance); // Must not be called after destruction.
-
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ServantShard& s = shard(ident);
+    lock_guard lock(s.mutex);
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
-
-    if(p == servantMapMap.end())
-    {
-        return false;
-    }
-    else
-    {
-        _servantMapMapHint = p;
-        assert(!p->second.empty());
-        return true;
-    }
+    ServantMapMap::const_iterator p = s.servantMapMap.find(ident);
+    assert(p == s.servantMapMap.end() || !p->second.empty());
+    return p != s.servantMapMap.end();
 }
 
 void
@@ -313,13 +228,14 @@ IceInternal::ServantManager::addServantLocator(const shared_ptr<ServantLocator>&
 
     assert(_instance); // Must not be called after destruction.
 
-    if((_locatorMapHint != _locatorMap.end() && _locatorMapHint->first == category)
-       || _locatorMap.find(category) != _locatorMap.end())
+    if(_locatorMap->find(category) != _locatorMap->end())
     {
         throw AlreadyRegisteredException(__FILE__, __LINE__, "servant locator", category);
     }
 
-    _locatorMapHint = _locatorMap.insert(_locatorMapHint, pair<const string, shared_ptr<ServantLocator>>(category, locator));
+    auto locatorMap = make_shared<LocatorMap>(*_locatorMap);
+    locatorMap->insert(pair<const string, shared_ptr<ServantLocator>>(category, locator));
+    atomic_store(&_locatorMap, shared_ptr<const LocatorMap>(std::move(locatorMap)));
 }
 
 shared_ptr<ServantLocator>
@@ -329,64 +245,32 @@ IceInternal::ServantManager::removeServantLocator(const string& category)
 
     assert(_instance); // Must not be called after destruction.
 
-    map<string, shared_ptr<ServantLocator>>::iterator p = _locatorMap.end();
-    if(_locatorMapHint != p)
-    {
-        if(_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if(p == _locatorMap.end())
-    {
-        p = _locatorMap.find(category);
-    }
-
-    if(p == _locatorMap.end())
+    LocatorMap::const_iterator p = _locatorMap->find(category);
+    if(p == _locatorMap->end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant locator", category);
     }
 
     shared_ptr<ServantLocator> locator = p->second;
-    _locatorMap.erase(p);
-    _locatorMapHint = _locatorMap.begin();
+
+    auto locatorMap = make_shared<LocatorMap>(*_locatorMap);
+    locatorMap->erase(category);
+    atomic_store(&_locatorMap, shared_ptr<const LocatorMap>(std::move(locatorMap)));
+
     return locator;
 }
 
 shared_ptr<ServantLocator>
 IceInternal::ServantManager::findServantLocator(const string& category) const
 {
-    lock_guard lock(_mutex);
-
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
+    // This method might be called after destruction if the adapter dispatches
+    // incoming requests from bidir connections.
     //
-    //assert(_instance); // Must not be called after destruction.
-
-    map<string, shared_ptr<ServantLocator>>& locatorMap =
-        const_cast<map<string, shared_ptr<ServantLocator>>&>(_locatorMap);
-
-    map<string, shared_ptr<ServantLocator>>::iterator p = locatorMap.end();
-    if(_locatorMapHint != locatorMap.end())
-    {
-        if(_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if(p == locatorMap.end())
+    shared_ptr<const LocatorMap> locatorMap = atomic_load(&_locatorMap);
+    LocatorMap::const_iterator p = locatorMap->find(category);
+    if(p != locatorMap->end())
     {
-        p = locatorMap.find(category);
-    }
-
-    if(p != locatorMap.end())
-    {
-        _locatorMapHint = p;
         return p->second;
     }
     else
@@ -398,8 +282,9 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
-      _locatorMapHint(_locatorMap.end())
+      _toStringMode(instance->toStringMode()),
+      _defaultServantMap(make_shared<const DefaultServantMap>()),
+      _locatorMap(make_shared<const LocatorMap>())
 {
 }
 
@@ -416,9 +301,9 @@ IceInternal::ServantManager::~ServantManager()
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
-    DefaultServantMap defaultServantMap;
-    map<string, shared_ptr<ServantLocator>> locatorMap;
+    vector<ServantMapMap> servantMapMaps;
+    shared_ptr<const DefaultServantMap> defaultServantMap;
+    shared_ptr<const LocatorMap> locatorMap;
     Ice::LoggerPtr logger;
 
     {
@@ -433,18 +318,20 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
-
-        defaultServantMap.swap(_defaultServantMap);
+        for(auto& s : _shards)
+        {
+            lock_guard shardLock(s.mutex);
+            servantMapMaps.push_back(std::move(s.servantMapMap));
+            s.servantMapMap.clear();
+        }
 
-        locatorMap.swap(_locatorMap);
-        _locatorMapHint = _locatorMap.end();
+        defaultServantMap = atomic_exchange(&_defaultServantMap, make_shared<const DefaultServantMap>());
+        locatorMap = atomic_exchange(&_locatorMap, make_shared<const LocatorMap>());
 
         _instance = 0;
     }
 
-    for(map<string, shared_ptr<ServantLocator>>::const_iterator p = locatorMap.begin(); p != locatorMap.end(); ++p)
+    for(LocatorMap::const_iterator p = locatorMap->begin(); p != locatorMap->end(); ++p)
     {
         try
         {
@@ -472,7 +359,7 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
-    locatorMap.clear();
-    defaultServantMap.clear();
+    servantMapMaps.clear();
+    locatorMap = nullptr;
+    defaultServantMap = nullptr;
 }
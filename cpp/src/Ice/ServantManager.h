@@ -9,8 +9,12 @@
 #include <Ice/InstanceF.h>
 #include <Ice/Identity.h>
 #include <Ice/FacetMap.h>
+#include <Ice/Communicator.h>
+#include <Ice/HashUtil.h>
 
+#include <array>
 #include <mutex>
+#include <unordered_map>
 
 namespace Ice
 {
@@ -48,20 +52,36 @@ private:
     void destroy();
     friend class Ice::ObjectAdapterI;
 
+    using ServantMapMap = std::unordered_map<Ice::Identity, Ice::FacetMap, IdentityHash>;
+    using DefaultServantMap = std::map<std::string, std::shared_ptr<Ice::Object>>;
+    using LocatorMap = std::map<std::string, std::shared_ptr<Ice::ServantLocator>>;
+
+    //
+    // The servants are partitioned by identity hash into shards, each with its own mutex,
+    // so that the dispatch of requests for different identities doesn't contend on the
+    // same mutex.
+    //
+    struct ServantShard
+    {
+        std::mutex mutex;
+        ServantMapMap servantMapMap;
+    };
+    ServantShard& shard(const Ice::Identity&) const;
+
     InstancePtr _instance;
 
     const std::string _adapterName;
+    const Ice::ToStringMode _toStringMode;
 
-    typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
-    typedef std::map<std::string, std::shared_ptr<Ice::Object>> DefaultServantMap;
-
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    mutable std::array<ServantShard, 32> _shards;
 
-    DefaultServantMap _defaultServantMap;
+    //
+    // Immutable copies of the default servants and servant locators, replaced with
+    // _mutex locked each time they're updated and loaded atomically by dispatch.
+    //
+    std::shared_ptr<const DefaultServantMap> _defaultServantMap;
+    std::shared_ptr<const LocatorMap> _locatorMap;
 
-    std::map<std::string, std::shared_ptr<Ice::ServantLocator>> _locatorMap;
-    mutable std::map<std::string, std::shared_ptr<Ice::ServantLocator>>::iterator _locatorMapHint;
     mutable std::mutex _mutex;
 };
 
@@ -6,8 +6,24 @@
 #include <Ice/NetworkProxy.h>
 #include <Ice/ProtocolInstance.h>
 
+#ifndef _WIN32
+#   include <sys/uio.h>
+#   include <climits>
+#endif
+
 using namespace IceInternal;
 
+namespace
+{
+
+#if defined(IOV_MAX)
+const int maxGatherBuffers = IOV_MAX;
+#else
+const int maxGatherBuffers = 16;
+#endif
+
+}
+
 StreamSocket::StreamSocket(const ProtocolInstancePtr& instance,
                            const NetworkProxyPtr& proxy,
                            const Address& addr,
@@ -193,6 +209,108 @@ StreamSocket::write(Buffer& buf)
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+SocketOperation
+StreamSocket::write(const std::vector<Buffer*>& bufs)
+{
+    assert(!bufs.empty());
+#ifdef _WIN32
+    return write(*bufs.front()); // No gathering on Windows.
+#else
+    if(_state == StateProxyWrite || bufs.size() == 1)
+    {
+        return write(*bufs.front());
+    }
+
+    assert(_fd != INVALID_SOCKET);
+    size_t next = 0; // The first buffer with data left to write.
+    while(true)
+    {
+        iovec iov[maxGatherBuffers];
+        int count = 0;
+        for(size_t k = next; k < bufs.size() && count < maxGatherBuffers; ++k)
+        {
+            Buffer* buf = bufs[k];
+            if(buf->i != buf->b.end())
+            {
+                iov[count].iov_base = &*buf->i;
+                iov[count].iov_len = static_cast<size_t>(buf->b.end() - buf->i);
+                ++count;
+            }
+        }
+
+        if(count == 0)
+        {
+            return SocketOperationNone;
+        }
+
+        ssize_t ret = ::writev(_fd, iov, count);
+        if(ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(noBuffers())
+            {
+                //
+                // Write the first pending buffer on its own, the single buffer
+                // write reduces the packet size until the send succeeds.
+                //
+                while(bufs[next]->i == bufs[next]->b.end())
+                {
+                    ++next;
+                }
+                if(write(*bufs[next]) != SocketOperationNone)
+                {
+                    return SocketOperationWrite;
+                }
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if(connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        //
+        // Advance the buffers in order over the sent bytes.
+        //
+        size_t sent = static_cast<size_t>(ret);
+        while(sent > 0)
+        {
+            Buffer* buf = bufs[next];
+            size_t remaining = static_cast<size_t>(buf->b.end() - buf->i);
+            if(sent < remaining)
+            {
+                buf->i += sent;
+                sent = 0;
+            }
+            else
+            {
+                buf->i = buf->b.end();
+                sent -= remaining;
+                ++next;
+            }
+        }
+    }
+#endif
+}
+
 ssize_t
 StreamSocket::read(char* buf, size_t length)
 {
@@ -244,6 +362,15 @@ StreamSocket::read(char* buf, size_t length)
         read += ret;
         length -= static_cast<size_t>(ret);
 
+        //
+        // If the socket returned less than requested, it's most likely drained and
+        // another recv() would only fail with EWOULDBLOCK.
+        //
+        if(static_cast<size_t>(ret) < packetSize)
+        {
+            break;
+        }
+
         if(packetSize > length)
         {
             packetSize = length;
@@ -10,6 +10,7 @@
 #include <Ice/ProtocolInstanceF.h>
 
 #include <memory>
+#include <vector>
 
 namespace IceInternal
 {
@@ -31,6 +32,7 @@ public:
 
     SocketOperation read(Buffer&);
     SocketOperation write(Buffer&);
+    SocketOperation write(const std::vector<Buffer*>&);
 
     ssize_t read(char*, size_t);
     ssize_t write(const char*, size_t);
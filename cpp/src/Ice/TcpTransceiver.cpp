@@ -49,6 +49,12 @@ IceInternal::TcpTransceiver::write(Buffer& buf)
     return _stream->write(buf);
 }
 
+SocketOperation
+IceInternal::TcpTransceiver::writev(const vector<Buffer*>& bufs)
+{
+    return _stream->write(bufs);
+}
+
 SocketOperation
 IceInternal::TcpTransceiver::read(Buffer& buf)
 {
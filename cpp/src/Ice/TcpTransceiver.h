@@ -29,6 +29,7 @@ public:
 
     void close() final;
     SocketOperation write(Buffer&) final;
+    SocketOperation writev(const std::vector<Buffer*>&) final;
     SocketOperation read(Buffer&) final;
 #if defined(ICE_USE_IOCP)
     bool startWrite(Buffer&) final;
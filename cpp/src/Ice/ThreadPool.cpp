@@ -25,6 +25,11 @@ using namespace IceInternal;
 namespace
 {
 
+//
+// The maximum number of lanes of the work queue.
+//
+const int laneCountMax = 16;
+
 class ShutdownWorkItem final : public ThreadPoolWorkItem
 {
 public:
@@ -150,7 +155,10 @@ IceInternal::DispatchWorkItem::execute(ThreadPoolCurrent& current)
 
 IceInternal::ThreadPoolWorkQueue::ThreadPoolWorkQueue(ThreadPool& threadPool) :
     _threadPool(threadPool),
-    _destroyed(false)
+    _destroyed(false),
+    _laneCount(static_cast<size_t>(min(max(threadPool._sizeMax, 1), laneCountMax))),
+    _lanes(new Lane[_laneCount]),
+    _size(0)
 {
     _registered = SocketOperationRead;
 }
@@ -160,7 +168,18 @@ IceInternal::ThreadPoolWorkQueue::destroy()
 {
     //lock_guard lock(_mutex); Called with the thread pool locked
     assert(!_destroyed);
-    _destroyed = true;
+    {
+        //
+        // Lock all the lanes to ensure dispatch() doesn't queue work items once destroyed.
+        //
+        vector<unique_lock<mutex>> locks;
+        locks.reserve(_laneCount);
+        for(size_t i = 0; i < _laneCount; ++i)
+        {
+            locks.emplace_back(_lanes[i].mutex);
+        }
+        _destroyed = true;
+    }
 #if defined(ICE_USE_IOCP)
     _threadPool._selector.completed(this, SocketOperationRead);
 #else
@@ -172,17 +191,51 @@ void
 IceInternal::ThreadPoolWorkQueue::queue(const ThreadPoolWorkItemPtr& item)
 {
     //lock_guard lock(_mutex); Called with the thread pool locked
-    _workItems.push_back(item);
 #if defined(ICE_USE_IOCP)
+    push(lane(0), item);
     _threadPool._selector.completed(this, SocketOperationRead);
 #else
-    if(_workItems.size() == 1)
+    if(push(lane(0), item))
     {
         _threadPool._selector.ready(this, SocketOperationRead, true);
     }
 #endif
 }
 
+void
+IceInternal::ThreadPoolWorkQueue::dispatch(const DispatchWorkItemPtr& workItem)
+{
+    //
+    // Called without the thread pool locked, the thread pool is only locked to update
+    // the selector once the work queue is no longer empty.
+    //
+    Lane& l = lane(workItem->getConnection().get());
+    bool wasEmpty;
+    {
+        lock_guard lock(l.mutex);
+        if(_destroyed)
+        {
+            throw CommunicatorDestroyedException(__FILE__, __LINE__);
+        }
+        l.workItems.push_back(workItem);
+        wasEmpty = _size++ == 0;
+    }
+
+#if defined(ICE_USE_IOCP)
+    lock_guard lock(_threadPool._mutex);
+    _threadPool._selector.completed(this, SocketOperationRead);
+#else
+    if(wasEmpty)
+    {
+        lock_guard lock(_threadPool._mutex);
+        if(!_destroyed)
+        {
+            _threadPool._selector.ready(this, SocketOperationRead, _size > 0);
+        }
+    }
+#endif
+}
+
 #if defined(ICE_USE_IOCP)
 bool
 IceInternal::ThreadPoolWorkQueue::startAsync(SocketOperation)
@@ -202,35 +255,42 @@ IceInternal::ThreadPoolWorkQueue::finishAsync(SocketOperation)
 void
 IceInternal::ThreadPoolWorkQueue::message(ThreadPoolCurrent& current)
 {
-    ThreadPoolWorkItemPtr workItem;
+    bool empty = false;
+    bool destroyed = false;
+    ThreadPoolWorkItemPtr workItem = pop(empty);
+    if(!workItem || empty)
     {
         lock_guard lock(_threadPool._mutex);
-        if(!_workItems.empty())
+        if(!workItem)
         {
-            workItem = _workItems.front();
-            _workItems.pop_front();
+            //
+            // The work queue is destroyed or another thread took the work item. Check the
+            // lanes again with the thread pool locked, work items queued before destroy()
+            // returned are visible to this thread once it sees the work queue destroyed.
+            //
+            workItem = pop(empty);
         }
 #if defined(ICE_USE_IOCP)
-        else
+        if(!workItem)
         {
             assert(_destroyed);
             _threadPool._selector.completed(this, SocketOperationRead);
         }
 #else
-        if(_workItems.empty() && !_destroyed)
+        if(!_destroyed)
         {
-            _threadPool._selector.ready(this, SocketOperationRead, false);
+            _threadPool._selector.ready(this, SocketOperationRead, _size > 0);
         }
 #endif
+        destroyed = _destroyed;
     }
 
     if(workItem)
     {
         workItem->execute(current);
     }
-    else
+    else if(destroyed)
     {
-        assert(_destroyed);
         current.ioCompleted();
         throw ThreadPoolDestroyedException();
     }
@@ -254,6 +314,51 @@ IceInternal::ThreadPoolWorkQueue::getNativeInfo()
     return 0;
 }
 
+IceInternal::ThreadPoolWorkQueue::Lane&
+IceInternal::ThreadPoolWorkQueue::lane(const void* key) const
+{
+    if(_laneCount == 1)
+    {
+        return _lanes[0];
+    }
+
+    //
+    // Use the lane of the calling thread if there's no key.
+    //
+    uint64_t h = key ? reinterpret_cast<uintptr_t>(key) : hash<thread::id>()(this_thread::get_id());
+    return _lanes[static_cast<size_t>((h * 0x9E3779B97F4A7C15ULL) >> 32) % _laneCount];
+}
+
+bool
+IceInternal::ThreadPoolWorkQueue::push(Lane& l, const ThreadPoolWorkItemPtr& item)
+{
+    lock_guard lock(l.mutex);
+    l.workItems.push_back(item);
+    return _size++ == 0;
+}
+
+ThreadPoolWorkItemPtr
+IceInternal::ThreadPoolWorkQueue::pop(bool& empty)
+{
+    //
+    // Start with the lane of the calling thread and steal from the other lanes if it's empty.
+    //
+    size_t first = static_cast<size_t>(&lane(0) - _lanes.get());
+    for(size_t i = 0; i < _laneCount && _size > 0; ++i)
+    {
+        Lane& l = _lanes[(first + i) % _laneCount];
+        lock_guard lock(l.mutex);
+        if(!l.workItems.empty())
+        {
+            ThreadPoolWorkItemPtr item = std::move(l.workItems.front());
+            l.workItems.pop_front();
+            empty = --_size == 0;
+            return item;
+        }
+    }
+    return nullptr;
+}
+
 ThreadPoolPtr
 IceInternal::ThreadPool::create(const InstancePtr& instance, const string& prefix, int timeout)
 {
@@ -262,7 +367,8 @@ IceInternal::ThreadPool::create(const InstancePtr& instance, const string& prefi
     return threadPool;
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout) :
+IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& prefix, int timeout,
+                                    const ThreadPool* parent, int reactorIndex) :
     _instance(instance),
 #ifdef ICE_SWIFT
     _dispatchQueue(dispatch_queue_create(prefixToDispatchQueueLabel(prefix).c_str(),
@@ -274,6 +380,9 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _prefix(prefix),
     _selector(instance),
     _nextThreadId(0),
+    _nextReactor(0),
+    _parent(parent),
+    _reactorIndex(reactorIndex),
     _size(0),
     _sizeIO(0),
     _sizeMax(0),
@@ -402,6 +511,51 @@ IceInternal::ThreadPool::initialize()
         const_cast<int&>(_priority) = properties->getPropertyAsInt("Ice.ThreadPriority");
     }
 
+    int reactors = _parent ? 0 : properties->getPropertyAsInt(_prefix + ".Reactors");
+#if defined(ICE_USE_IOCP)
+    if(reactors > 1)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".Reactors isn't supported with IOCP; Reactors ignored";
+    }
+#else
+    if(reactors > 1 && _serverIdleTime > 0)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".Reactors isn't supported with Ice.ServerIdleTime; ServerIdleTime ignored";
+    }
+
+    if(reactors > 1)
+    {
+        if(_instance->traceLevels()->threadPool >= 1)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
+            out << "creating " << _prefix << ": Reactors = " << reactors;
+        }
+
+        //
+        // Each reactor is configured with the properties of this thread pool. The reactors
+        // don't support the server idle time: a reactor can be idle while others are busy.
+        //
+        try
+        {
+            for(int i = 0; i < reactors; ++i)
+            {
+                auto reactor = std::shared_ptr<ThreadPool>(new ThreadPool(_instance, _prefix, 0, this, i));
+                reactor->initialize();
+                _reactors.push_back(std::move(reactor));
+            }
+        }
+        catch(const IceUtil::Exception&)
+        {
+            destroy();
+            joinWithAllThreads();
+            throw;
+        }
+        return;
+    }
+#endif
+
     _workQueue = make_shared<ThreadPoolWorkQueue>(*this);
     _selector.initialize(_workQueue.get());
 
@@ -451,7 +605,14 @@ IceInternal::ThreadPool::destroy()
         return;
     }
     _destroyed = true;
-    _workQueue->destroy();
+    if(_workQueue)
+    {
+        _workQueue->destroy();
+    }
+    for(const auto& reactor : _reactors)
+    {
+        reactor->destroy();
+    }
 }
 
 void
@@ -462,11 +623,28 @@ IceInternal::ThreadPool::updateObservers()
     {
         p->updateObserver();
     }
+    for(const auto& reactor : _reactors)
+    {
+        reactor->updateObservers();
+    }
 }
 
 void
 IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 {
+    if(!_reactors.empty())
+    {
+        ThreadPool* reactor;
+        {
+            lock_guard lock(_mutex);
+            assert(!_destroyed);
+            reactor = _reactors[_nextReactor++ % _reactors.size()].get();
+        }
+        handler->_reactor = reactor;
+        reactor->initialize(handler);
+        return;
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
     _selector.initialize(handler.get());
@@ -496,6 +674,12 @@ IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 void
 IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation remove, SocketOperation add)
 {
+    if(!_reactors.empty())
+    {
+        reactor(handler)->update(handler, remove, add);
+        return;
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
 
@@ -516,6 +700,11 @@ IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation
 bool
 IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 {
+    if(!_reactors.empty())
+    {
+        return reactor(handler)->finish(handler, closeNow);
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
 #if !defined(ICE_USE_IOCP)
@@ -542,6 +731,12 @@ IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 void
 IceInternal::ThreadPool::ready(const EventHandlerPtr& handler, SocketOperation op, bool value)
 {
+    if(!_reactors.empty())
+    {
+        reactor(handler)->ready(handler, op, value);
+        return;
+    }
+
     lock_guard lock(_mutex);
     if(_destroyed)
     {
@@ -596,12 +791,40 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
 void
 IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
 {
-    lock_guard lock(_mutex);
-    if(_destroyed)
+    if(!_reactors.empty())
     {
-        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+        //
+        // Dispatch the work item with the reactor of its connection if the connection is
+        // registered with one of the reactors of this thread pool. The work items of other
+        // connections go to the reactor picked by the connection hash, so that they keep
+        // their order, and the work items without connection to the next reactor.
+        //
+        ThreadPool* reactor = 0;
+        const Ice::ConnectionPtr& connection = workItem->getConnection();
+        EventHandler* handler = dynamic_cast<EventHandler*>(connection.get());
+        if(handler && handler->_reactor && handler->_reactor->_parent == this)
+        {
+            reactor = handler->_reactor;
+        }
+        else if(connection)
+        {
+            uint64_t h = reinterpret_cast<uintptr_t>(connection.get());
+            reactor = _reactors[static_cast<size_t>((h * 0x9E3779B97F4A7C15ULL) >> 32) % _reactors.size()].get();
+        }
+        else
+        {
+            lock_guard lock(_mutex);
+            if(_destroyed)
+            {
+                throw CommunicatorDestroyedException(__FILE__, __LINE__);
+            }
+            reactor = _reactors[_nextReactor++ % _reactors.size()].get();
+        }
+        reactor->dispatch(workItem);
+        return;
     }
-    _workQueue->queue(workItem);
+
+    _workQueue->dispatch(workItem);
 }
 
 void
@@ -645,6 +868,10 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->join();
     }
+    for(const auto& reactor : _reactors)
+    {
+        reactor->joinWithAllThreads();
+    }
     _selector.destroy();
 }
 
@@ -1167,11 +1394,23 @@ IceInternal::ThreadPool::followerWait(ThreadPoolCurrent& current, unique_lock<mu
 }
 #endif
 
+ThreadPool*
+IceInternal::ThreadPool::reactor(const EventHandlerPtr& handler) const
+{
+    assert(handler->_reactor); // Set by initialize().
+    return handler->_reactor;
+}
+
 string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++;
+    os << _prefix << "-";
+    if(_parent)
+    {
+        os << _reactorIndex << "-";
+    }
+    os << _nextThreadId++;
     return os.str();
 }
 
@@ -17,6 +17,8 @@
 
 #include <set>
 #include <list>
+#include <deque>
+#include <atomic>
 
 namespace IceInternal
 {
@@ -26,7 +28,7 @@ class ThreadPoolCurrent;
 class ThreadPoolWorkQueue;
 using ThreadPoolWorkQueuePtr = std::shared_ptr<ThreadPoolWorkQueue>;
 
-class ThreadPoolWorkItem
+class ICE_API ThreadPoolWorkItem
 {
 public:
 
@@ -34,7 +36,7 @@ public:
 };
 using ThreadPoolWorkItemPtr = std::shared_ptr<ThreadPoolWorkItem>;
 
-class DispatchWorkItem :
+class ICE_API DispatchWorkItem :
     public ThreadPoolWorkItem,
     public std::enable_shared_from_this<DispatchWorkItem>
 {
@@ -59,7 +61,7 @@ private:
 };
 using DispatchWorkItemPtr = std::shared_ptr<DispatchWorkItem>;
 
-class ThreadPool : public std::enable_shared_from_this<ThreadPool>
+class ICE_API ThreadPool : public std::enable_shared_from_this<ThreadPool>
 {
 public:
 
@@ -120,11 +122,13 @@ public:
 
 private:
 
-    ThreadPool(const InstancePtr&, const std::string&, int);
+    ThreadPool(const InstancePtr&, const std::string&, int, const ThreadPool* = nullptr, int = -1);
     void initialize();
 
     void run(const EventHandlerThreadPtr&);
 
+    ThreadPool* reactor(const EventHandlerPtr&) const;
+
     bool ioCompleted(ThreadPoolCurrent&);
 
 #if defined(ICE_USE_IOCP)
@@ -149,6 +153,16 @@ private:
     Selector _selector;
     int _nextThreadId;
 
+    //
+    // With Reactors > 1, the thread pool delegates to reactors: thread pools with their
+    // own selector and threads. Each event handler is assigned to a reactor when it's
+    // initialized and its IO and dispatch are handled by the threads of this reactor.
+    //
+    std::vector<ThreadPoolPtr> _reactors;
+    size_t _nextReactor;
+    const ThreadPool* const _parent; // The thread pool of this reactor, null if not a reactor.
+    const int _reactorIndex; // The index of this reactor in the reactors of its parent.
+
     friend class EventHandlerThread;
     friend class ThreadPoolCurrent;
     friend class ThreadPoolWorkQueue;
@@ -236,6 +250,7 @@ public:
 
     void destroy();
     void queue(const ThreadPoolWorkItemPtr&);
+    void dispatch(const DispatchWorkItemPtr&);
 
 #if defined(ICE_USE_IOCP)
     bool startAsync(SocketOperation);
@@ -249,9 +264,28 @@ public:
 
 private:
 
+    //
+    // The work items are queued on lanes, each protected by its own mutex, to avoid
+    // locking the thread pool for each work item. The lane of a work item is picked
+    // from its connection, the work items of a connection are therefore executed in
+    // order, or from the queuing thread. A thread executes the work items of its own
+    // lane first and steals work items from the other lanes when its lane is empty.
+    //
+    struct Lane
+    {
+        std::mutex mutex;
+        std::deque<ThreadPoolWorkItemPtr> workItems;
+    };
+
+    Lane& lane(const void*) const;
+    bool push(Lane&, const ThreadPoolWorkItemPtr&);
+    ThreadPoolWorkItemPtr pop(bool&);
+
     ThreadPool& _threadPool;
-    bool _destroyed;
-    std::list<ThreadPoolWorkItemPtr> _workItems;
+    bool _destroyed; // Set with the thread pool and all the lanes locked.
+    const size_t _laneCount;
+    const std::unique_ptr<Lane[]> _lanes;
+    std::atomic<size_t> _size; // Number of queued work items.
 };
 
 //
@@ -6,10 +6,321 @@
 #include <IceUtil/Exception.h>
 #include <Ice/ConsoleUtil.h>
 
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+
 using namespace std;
 using namespace IceUtil;
 using namespace IceInternal;
 
+namespace
+{
+
+//
+// The root level of the timing wheel has one slot per tick for the next 256 ticks and each
+// of the following levels has 64 slots which cover 64 times the range of the previous
+// level. Tasks further than the last level are kept in its farthest slot until they get
+// closer.
+//
+const int rootBits = 8;
+const int levelBits = 6;
+const int levelCount = 4;
+const uint64_t rootSize = 1 << rootBits;
+const uint64_t rootMask = rootSize - 1;
+const uint64_t levelSize = 1 << levelBits;
+const uint64_t levelMask = levelSize - 1;
+
+}
+
+struct Timer::Wheel
+{
+    enum class State
+    {
+        Scheduled,
+        Ready,
+        Running
+    };
+
+    struct Entry
+    {
+        TimerTaskPtr task;
+        optional<chrono::nanoseconds> delay;
+        uint64_t expiration;
+        State state;
+        Entry** slot;
+        Entry* prev;
+        Entry* next;
+    };
+
+    Wheel(chrono::milliseconds resolution) :
+        start(chrono::steady_clock::now()),
+        tick(chrono::duration_cast<chrono::nanoseconds>(resolution).count()),
+        nextTick(0),
+        linked(0)
+    {
+        clear();
+    }
+
+    // Returns false if the task is already scheduled.
+    bool add(const TimerTaskPtr& task, chrono::steady_clock::time_point time, optional<chrono::nanoseconds> delay)
+    {
+        auto p = entries.emplace(task.get(), Entry { task, delay, 0, State::Ready, nullptr, nullptr, nullptr });
+        if(!p.second)
+        {
+            return false;
+        }
+
+        Entry& entry = p.first->second;
+        const auto now = chrono::steady_clock::now();
+        if(time <= now)
+        {
+            ready.push_back(task.get());
+        }
+        else
+        {
+            skipIdleTicks(now);
+            entry.expiration = max(ticks(time), nextTick);
+            link(&entry);
+        }
+        return true;
+    }
+
+    bool remove(const TimerTaskPtr& task)
+    {
+        auto p = entries.find(task.get());
+        if(p == entries.end())
+        {
+            return false;
+        }
+        if(p->second.state == State::Scheduled)
+        {
+            unlink(&p->second);
+        }
+        entries.erase(p);
+        return true;
+    }
+
+    // Schedule again a repeated task once it ran, unless it was canceled.
+    void reschedule(const TimerTaskPtr& task, chrono::steady_clock::time_point time)
+    {
+        auto p = entries.find(task.get());
+        if(p != entries.end() && p->second.state == State::Running)
+        {
+            skipIdleTicks(chrono::steady_clock::now());
+            p->second.expiration = max(ticks(time), nextTick);
+            link(&p->second);
+        }
+    }
+
+    // Move the tasks of the elapsed ticks to the ready queue.
+    void advance(chrono::steady_clock::time_point now)
+    {
+        if(now < start)
+        {
+            return;
+        }
+
+        const uint64_t last = elapsed(now);
+        while(nextTick <= last)
+        {
+            if(linked == 0)
+            {
+                nextTick = last + 1;
+                break;
+            }
+
+            uint64_t index = nextTick & rootMask;
+            if(index == 0)
+            {
+                for(int i = 0; i < levelCount; ++i)
+                {
+                    uint64_t slot = (nextTick >> (rootBits + i * levelBits)) & levelMask;
+                    cascade(levels[i][slot]);
+                    if(slot != 0)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            Entry* entry = root[index];
+            root[index] = nullptr;
+            while(entry)
+            {
+                --linked;
+                entry->state = State::Ready;
+                entry->slot = nullptr;
+                ready.push_back(entry->task.get());
+                entry = entry->next;
+            }
+            ++nextTick;
+        }
+    }
+
+    //
+    // Returns the next ready task, the ready queue can contain tasks which were canceled or
+    // rescheduled since they were queued, they are skipped.
+    //
+    bool next(TimerTaskPtr& task, optional<chrono::nanoseconds>& delay)
+    {
+        while(!ready.empty())
+        {
+            auto p = entries.find(ready.front());
+            ready.pop_front();
+            if(p != entries.end() && p->second.state == State::Ready)
+            {
+                delay = p->second.delay;
+                if(delay)
+                {
+                    p->second.state = State::Running;
+                    task = p->second.task;
+                }
+                else
+                {
+                    task = std::move(p->second.task);
+                    entries.erase(p);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool empty() const
+    {
+        return entries.empty();
+    }
+
+    //
+    // The time of the next tick with tasks to run or whose higher levels must be cascaded, this
+    // is at most the start of the next rotation of the root level.
+    //
+    chrono::steady_clock::time_point wakeUpTime() const
+    {
+        uint64_t t = nextTick;
+        while((t & rootMask) != 0 && !root[t & rootMask])
+        {
+            ++t;
+        }
+        return start + chrono::nanoseconds(static_cast<int64_t>(t * tick));
+    }
+
+    void clear()
+    {
+        entries.clear();
+        ready.clear();
+        linked = 0;
+        fill(begin(root), end(root), nullptr);
+        for(auto& level : levels)
+        {
+            fill(begin(level), end(level), nullptr);
+        }
+    }
+
+private:
+
+    uint64_t ticks(chrono::steady_clock::time_point time) const
+    {
+        return (static_cast<uint64_t>((time - start).count()) + tick - 1) / tick;
+    }
+
+    // The last elapsed tick.
+    uint64_t elapsed(chrono::steady_clock::time_point now) const
+    {
+        return now < start ? 0 : static_cast<uint64_t>((now - start).count()) / tick;
+    }
+
+    //
+    // The timer thread doesn't advance the wheel while no task is linked, move to the current
+    // tick before linking a task so that the wheel doesn't have to walk all the idle ticks.
+    //
+    void skipIdleTicks(chrono::steady_clock::time_point now)
+    {
+        if(linked == 0 && now >= start)
+        {
+            nextTick = max(nextTick, elapsed(now) + 1);
+        }
+    }
+
+    void link(Entry* entry)
+    {
+        ++linked;
+        entry->state = State::Scheduled;
+
+        uint64_t expiration = entry->expiration;
+        uint64_t index = expiration - nextTick;
+        if(index < rootSize)
+        {
+            entry->slot = &root[expiration & rootMask];
+        }
+        else
+        {
+            int i = 0;
+            while(i < levelCount - 1 && index >= (uint64_t(1) << (rootBits + (i + 1) * levelBits)))
+            {
+                ++i;
+            }
+
+            const uint64_t range = uint64_t(1) << (rootBits + levelCount * levelBits);
+            if(index >= range)
+            {
+                expiration = nextTick + range - 1;
+            }
+            entry->slot = &levels[i][(expiration >> (rootBits + i * levelBits)) & levelMask];
+        }
+
+        entry->prev = nullptr;
+        entry->next = *entry->slot;
+        if(entry->next)
+        {
+            entry->next->prev = entry;
+        }
+        *entry->slot = entry;
+    }
+
+    void unlink(Entry* entry)
+    {
+        --linked;
+        if(entry->prev)
+        {
+            entry->prev->next = entry->next;
+        }
+        else
+        {
+            *entry->slot = entry->next;
+        }
+        if(entry->next)
+        {
+            entry->next->prev = entry->prev;
+        }
+        entry->slot = nullptr;
+    }
+
+    void cascade(Entry*& slot)
+    {
+        Entry* entry = slot;
+        slot = nullptr;
+        while(entry)
+        {
+            Entry* next = entry->next;
+            --linked;
+            link(entry);
+            entry = next;
+        }
+    }
+
+    const chrono::steady_clock::time_point start;
+    const uint64_t tick; // The resolution in nanoseconds.
+    uint64_t nextTick; // The first tick which hasn't elapsed yet.
+    size_t linked; // The number of tasks linked in the wheel slots.
+
+    unordered_map<const TimerTask*, Entry> entries;
+    deque<const TimerTask*> ready;
+    Entry* root[rootSize];
+    Entry* levels[levelCount][levelSize];
+};
+
 TimerTask::~TimerTask()
 {
     // Out of line to avoid weak vtable
@@ -22,6 +333,19 @@ Timer::Timer() :
 {
 }
 
+Timer::Timer(chrono::milliseconds resolution) :
+    _destroyed(false),
+    _wakeUpTime(chrono::steady_clock::time_point()),
+    _wheel(resolution > chrono::milliseconds::zero() ? make_unique<Wheel>(resolution) : nullptr),
+    _worker(&Timer::run, this)
+{
+}
+
+Timer::~Timer()
+{
+    // Out of line for the destruction of the wheel
+}
+
 void
 Timer::destroy()
 {
@@ -34,6 +358,10 @@ Timer::destroy()
         _destroyed = true;
         _tasks.clear();
         _tokens.clear();
+        if(_wheel)
+        {
+            _wheel->clear();
+        }
         _condition.notify_one();
     }
 
@@ -56,6 +384,11 @@ Timer::cancel(const TimerTaskPtr& task)
         return false;
     }
 
+    if(_wheel)
+    {
+        return _wheel->remove(task);
+    }
+
     auto p = _tasks.find(task);
     if(p == _tasks.end())
     {
@@ -68,8 +401,46 @@ Timer::cancel(const TimerTaskPtr& task)
     return true;
 }
 
+void
+Timer::schedule(const TimerTaskPtr& task, chrono::steady_clock::time_point time, optional<chrono::nanoseconds> delay)
+{
+    lock_guard lock(_mutex);
+    if (_destroyed)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
+    }
+
+    if (_wheel)
+    {
+        if (!_wheel->add(task, time, delay))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
+        }
+    }
+    else
+    {
+        bool inserted = _tasks.insert(make_pair(task, time)).second;
+        if (!inserted)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
+        }
+        _tokens.insert({ time, delay, task });
+    }
+
+    if(_wakeUpTime == chrono::steady_clock::time_point() || time < _wakeUpTime)
+    {
+        _condition.notify_one();
+    }
+}
+
 void Timer::run()
 {
+    if (_wheel)
+    {
+        runWheel();
+        return;
+    }
+
     Token token { chrono::steady_clock::time_point(), nullopt, nullptr };
     while (true)
     {
@@ -130,35 +501,95 @@ void Timer::run()
 
         if (token.task)
         {
-            try
-            {
-                runTimerTask(token.task);
-            }
-            catch(const IceUtil::Exception& e)
+            runTask(token.task);
+
+            if (!token.delay)
             {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what();
-#ifdef __GNUC__
-                consoleErr << "\n" << e.ice_stackTrace();
-#endif
-                consoleErr << endl;
+                // If the task is not a repeated task, clear the task reference now rather than
+                // in the synchronization block above. Clearing the task reference might end up
+                // calling user code which could trigger a deadlock. See also issue #352.
+                token.task = nullptr;
             }
-            catch(const std::exception& e)
+        }
+    }
+}
+
+void
+Timer::runWheel()
+{
+    TimerTaskPtr task;
+    optional<chrono::nanoseconds> delay;
+    while (true)
+    {
+        {
+            unique_lock lock(_mutex);
+
+            // If the task we just ran is a repeated task, schedule it again for execution if it wasn't canceled.
+            if (!_destroyed && task && delay)
             {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what() << endl;
+                _wheel->reschedule(task, chrono::steady_clock::now() + delay.value());
             }
-            catch(...)
+            task = nullptr;
+            delay = nullopt;
+
+            while (!_destroyed)
             {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception" << endl;
+                _wheel->advance(chrono::steady_clock::now());
+                if (_wheel->next(task, delay))
+                {
+                    break;
+                }
+
+                if (_wheel->empty())
+                {
+                    _wakeUpTime = chrono::steady_clock::time_point();
+                    _condition.wait(lock);
+                }
+                else
+                {
+                    _wakeUpTime = _wheel->wakeUpTime();
+                    _condition.wait_until(lock, _wakeUpTime);
+                }
             }
 
-            if (!token.delay)
+            if (_destroyed)
             {
-                // If the task is not a repeated task, clear the task reference now rather than
-                // in the synchronization block above. Clearing the task reference might end up
-                // calling user code which could trigger a deadlock. See also issue #352.
-                token.task = nullptr;
+                break;
             }
         }
+
+        runTask(task);
+
+        if (!delay)
+        {
+            // Clear the task reference outside the synchronization, see run().
+            task = nullptr;
+        }
+    }
+}
+
+void
+Timer::runTask(const TimerTaskPtr& task)
+{
+    try
+    {
+        runTimerTask(task);
+    }
+    catch(const IceUtil::Exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what();
+#ifdef __GNUC__
+        consoleErr << "\n" << e.ice_stackTrace();
+#endif
+        consoleErr << endl;
+    }
+    catch(const std::exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what() << endl;
+    }
+    catch(...)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception" << endl;
     }
 }
 
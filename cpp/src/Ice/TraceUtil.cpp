@@ -174,6 +174,18 @@ printHeader(ostream& s, InputStream& stream)
             break;
         }
 
+        case 3:
+        {
+            s << "(compressed with LZ4; compress response, if any)";
+            break;
+        }
+
+        case 4:
+        {
+            s << "(not compressed; LZ4 supported; compress response, if any)";
+            break;
+        }
+
         default:
         {
             s << "(unknown)";
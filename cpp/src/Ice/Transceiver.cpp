@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Transceiver.h>
+#include <Ice/Buffer.h>
 
 using namespace std;
 using namespace Ice;
@@ -14,3 +15,25 @@ IceInternal::Transceiver::bind()
     assert(false);
     return nullptr;
 }
+
+SocketOperation
+IceInternal::Transceiver::writev(const vector<Buffer*>& bufs)
+{
+    //
+    // Transceivers which can't gather buffers write them one at a time until a
+    // write blocks.
+    //
+    assert(!bufs.empty());
+    for(vector<Buffer*>::const_iterator p = bufs.begin(); p != bufs.end(); ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            SocketOperation op = write(**p);
+            if(op != SocketOperationNone)
+            {
+                return op;
+            }
+        }
+    }
+    return SocketOperationNone;
+}
@@ -10,6 +10,8 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/Network.h>
 
+#include <vector>
+
 namespace IceInternal
 {
 
@@ -27,6 +29,7 @@ public:
     virtual void close() = 0;
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&) = 0;
+    virtual SocketOperation writev(const std::vector<Buffer*>&);
     virtual SocketOperation read(Buffer&) = 0;
 #if defined(ICE_USE_IOCP)
     virtual bool startWrite(Buffer&) = 0;
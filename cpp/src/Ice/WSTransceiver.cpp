@@ -824,6 +824,7 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readFrameOffset(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(16 * 1024),
     _readPending(false),
@@ -852,6 +853,7 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readFrameOffset(0),
     _writeState(WriteStateHeader),
     _writeBufferSize(1024),
     _readPending(false),
@@ -1240,7 +1242,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                 }
                 _readState = ReadStatePayload;
                 assert(buf.i != buf.b.end());
-                _readFrameStart = buf.i;
+                _readFrameOffset = 0;
                 break;
             }
             case OP_CLOSE: // Connection close
@@ -1394,14 +1396,16 @@ IceInternal::WSTransceiver::postRead(Buffer& buf)
     if(_incoming)
     {
         //
-        // Unmask the data we just read.
+        // Unmask the data we just read. The payload of a frame might be read in several
+        // buffers, the mask is applied based on the offset of the data in the payload.
         //
         IceInternal::Buffer::Container::iterator p = _readStart;
-        for(size_t n = static_cast<size_t>(_readStart - _readFrameStart); p < buf.i; ++p, ++n)
+        for(size_t n = _readFrameOffset; p < buf.i; ++p, ++n)
         {
             *p ^= _readMask[n % 4];
         }
     }
+    _readFrameOffset += static_cast<size_t>(buf.i - _readStart);
 
     _readPayloadLength -= static_cast<size_t>(buf.i - _readStart);
     _readStart = buf.i;
@@ -111,7 +111,7 @@ private:
     size_t _readHeaderLength;
     size_t _readPayloadLength;
     Buffer::Container::iterator _readStart;
-    Buffer::Container::iterator _readFrameStart;
+    size_t _readFrameOffset; // The number of payload bytes of the frame already read.
     unsigned char _readMask[4];
 
     enum WriteState
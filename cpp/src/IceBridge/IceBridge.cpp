@@ -22,13 +22,14 @@ struct QueuedDispatch final
 {
     //
     // The pointers in p refer to the Ice marshaling buffer and won't remain valid after
-    // ice_invokeAsync completes, so we have to make a copy of the in parameters
+    // ice_invokeAsync completes, so we have to make a copy of the request
     //
     QueuedDispatch(pair<const Byte*, const Byte*> p,
                    function<void(bool, const pair<const Byte*, const Byte*>&)>&& r,
+                   function<void(const pair<const Byte*, const Byte*>&)>&& rp,
                    function<void(exception_ptr)>&& e,
                    const Current& c) :
-        inParams(p.first, p.second), response(std::move(r)), error(std::move(e)), current(c)
+        request(p.first, p.second), response(std::move(r)), reply(std::move(rp)), error(std::move(e)), current(c)
     {
     }
 
@@ -37,8 +38,9 @@ struct QueuedDispatch final
     // Make sure we don't copy this struct by accident
     QueuedDispatch(const QueuedDispatch&) = delete;
 
-    const vector<Byte> inParams;
+    const vector<Byte> request;
     function<void(bool, const pair<const Byte*, const Byte*>&)> response;
+    function<void(const pair<const Byte*, const Byte*>&)> reply;
     function<void(exception_ptr)> error;
     const Current current;
 };
@@ -105,6 +107,7 @@ public:
     void closed(const shared_ptr<Connection>&);
     void dispatch(pair<const Byte*, const Byte*>,
                   function<void(bool, const pair<const Byte*, const Byte*>&)>,
+                  function<void(const pair<const Byte*, const Byte*>&)>,
                   function<void(exception_ptr)>,
                   const Current&);
 private:
@@ -112,6 +115,7 @@ private:
     void send(const shared_ptr<Connection>&,
               pair<const Byte*, const Byte*>,
               function<void(bool, const pair<const Byte*, const Byte*>&)>,
+              function<void(const pair<const Byte*, const Byte*>&)>,
               function<void(exception_ptr)>,
               const Current& current);
 
@@ -135,14 +139,16 @@ private:
 //
 // The main bridge servant.
 //
-class BridgeI final : public Ice::BlobjectArrayAsync, public enable_shared_from_this<BridgeI>
+class BridgeI final : public Ice::BlobjectForwardAsync, public enable_shared_from_this<BridgeI>
 {
 public:
 
     BridgeI(shared_ptr<ObjectAdapter> adapter, ObjectPrxPtr target);
 
-    void ice_invokeAsync(pair<const Byte*, const Byte*> inEncaps,
+    void ice_invokeAsync(pair<const Byte*, const Byte*> request,
+                         pair<const Byte*, const Byte*> inEncaps,
                          function<void(bool, const pair<const Byte*, const Byte*>&)> response,
+                         function<void(const pair<const Byte*, const Byte*>&)> reply,
                          function<void(exception_ptr)> error,
                          const Current& current) override;
 
@@ -233,8 +239,8 @@ BridgeConnection::outgoingSuccess(shared_ptr<Connection> outgoing)
     //
     for(auto& p : _queue)
     {
-        auto inParams = make_pair(p.inParams.data(), p.inParams.data() + p.inParams.size());
-        send(_outgoing, inParams, std::move(p.response), std::move(p.error), p.current);
+        auto request = make_pair(p.request.data(), p.request.data() + p.request.size());
+        send(_outgoing, request, std::move(p.response), std::move(p.reply), std::move(p.error), p.current);
     }
     _queue.clear();
 }
@@ -312,8 +318,9 @@ BridgeConnection::closed(const shared_ptr<Connection>& con)
 }
 
 void
-BridgeConnection::dispatch(pair<const Byte*, const Byte*> inParams,
+BridgeConnection::dispatch(pair<const Byte*, const Byte*> request,
                            function<void(bool, const pair<const Byte*, const Byte*>&)> response,
+                           function<void(const pair<const Byte*, const Byte*>&)> reply,
                            function<void(exception_ptr)> error,
                            const Current& current)
 {
@@ -333,25 +340,28 @@ BridgeConnection::dispatch(pair<const Byte*, const Byte*> inParams,
         // Queue the invocation until the outgoing connection is established.
         //
         assert(current.con == _incoming);
-        _queue.emplace_back(inParams, std::move(response), std::move(error), current);
+        _queue.emplace_back(request, std::move(response), std::move(reply), std::move(error), current);
     }
     else
     {
-        send(current.con == _incoming ? _outgoing : _incoming, inParams, std::move(response), std::move(error), current);
+        send(current.con == _incoming ? _outgoing : _incoming, request, std::move(response), std::move(reply),
+             std::move(error), current);
     }
 }
 
 void
 BridgeConnection::send(const shared_ptr<Connection>& dest,
-                       pair<const Byte*, const Byte*> inParams,
+                       pair<const Byte*, const Byte*> request,
                        function<void(bool, const pair<const Byte*, const Byte*>&)> response,
+                       function<void(const pair<const Byte*, const Byte*>&)> reply,
                        function<void(exception_ptr)> error,
                        const Current& current)
 {
     try
     {
         //
-        // Create a proxy having the same identity as the request.
+        // Create a proxy having the same identity as the request. The request is forwarded
+        // as is, with its identity, facet and context, and so is the reply.
         //
         auto prx = dest->createProxy(current.id);
 
@@ -362,15 +372,14 @@ BridgeConnection::send(const shared_ptr<Connection>& dest,
             {
                 prx = prx->ice_oneway();
             }
-            prx->ice_invokeAsync(current.operation, current.mode, inParams, nullptr, error,
-                                 [response = std::move(response)](bool){ response(true, {nullptr, nullptr}); },
-                                 current.ctx);
+            prx->ice_forwardAsync(request, nullptr, error,
+                                  [response = std::move(response)](bool){ response(true, {nullptr, nullptr}); },
+                                  current);
         }
         else
         {
             // Twoway request
-            prx->ice_invokeAsync(current.operation, current.mode, inParams, std::move(response), error,
-                                 nullptr, current.ctx);
+            prx->ice_forwardAsync(request, std::move(reply), error, nullptr, current);
         }
     }
     catch(const std::exception&)
@@ -386,8 +395,10 @@ BridgeI::BridgeI(shared_ptr<ObjectAdapter> adapter, ObjectPrxPtr target) :
 }
 
 void
-BridgeI::ice_invokeAsync(pair<const Byte*, const Byte*> inParams,
+BridgeI::ice_invokeAsync(pair<const Byte*, const Byte*> request,
+                         pair<const Byte*, const Byte*>,
                          function<void(bool, const pair<const Byte*, const Byte*>&)> response,
+                         function<void(const pair<const Byte*, const Byte*>&)> reply,
                          function<void(exception_ptr)> error,
                          const Current& current)
 {
@@ -459,7 +470,7 @@ BridgeI::ice_invokeAsync(pair<const Byte*, const Byte*> inParams,
     //
     // Delegate the invocation to the BridgeConnection object.
     //
-    bc->dispatch(inParams, std::move(response), std::move(error), current);
+    bc->dispatch(request, std::move(response), std::move(reply), std::move(error), current);
 }
 
 void
@@ -7,6 +7,7 @@
 #include <IceStorm/Observers.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/InstrumentationI.h>
+#include <IceStorm/Subscriber.h>
 #include <IceUtil/Timer.h>
 
 #include <Ice/InstrumentationI.h>
@@ -40,6 +41,145 @@ TopicReaper::consumeReapedTopics()
     return reaped;
 }
 
+namespace
+{
+
+// Set for the publish shard threads.
+thread_local bool publishShardThread = false;
+
+}
+
+PublishShards::PublishShards(size_t size, size_t queueSizeMax, shared_ptr<Ice::Logger> logger) :
+    _queueSizeMax(queueSizeMax),
+    _logger(std::move(logger)),
+    _dropped(0)
+{
+    for(size_t i = 0; i < size; ++i)
+    {
+        _shards.push_back(make_unique<Shard>());
+    }
+    for(const auto& shard : _shards)
+    {
+        shard->thread = thread([this, &shard = *shard] { run(shard); });
+    }
+}
+
+PublishShards::~PublishShards()
+{
+    if(_dropped > 0)
+    {
+        Ice::Warning warn(_logger);
+        warn << "dropped the events of " << _dropped << " publish tasks dispatched after shutdown";
+    }
+}
+
+size_t
+PublishShards::size() const
+{
+    return _shards.size();
+}
+
+SubscriberShards
+PublishShards::partition(const vector<shared_ptr<Subscriber>>& subscribers) const
+{
+    //
+    // The shard of a subscriber only depends on its identity, it doesn't change
+    // when other subscribers are added or removed.
+    //
+    SubscriberShards shards(_shards.size());
+    hash<string> hasher;
+    for(const auto& subscriber : subscribers)
+    {
+        const Ice::Identity& id = subscriber->id();
+        size_t h = hasher(id.name) * 31 + hasher(id.category);
+        shards[h % shards.size()].push_back(subscriber);
+    }
+    return shards;
+}
+
+void
+PublishShards::dispatch(size_t index, function<void()> task)
+{
+    Shard& shard = *_shards[index];
+    unique_lock<mutex> lock(shard.mutex);
+
+    //
+    // Wait for the shard's thread to catch up if the queue is full, this pushes back
+    // on the publisher. A shard thread doesn't wait, it could wait for itself.
+    //
+    if(_queueSizeMax > 0 && !publishShardThread)
+    {
+        shard.notFull.wait(lock, [this, &shard] { return shard.destroyed || shard.tasks.size() < _queueSizeMax; });
+    }
+
+    if(shard.destroyed)
+    {
+        if(_dropped++ == 0)
+        {
+            Ice::Warning warn(_logger);
+            warn << "dropping the events published after shutdown";
+        }
+        return;
+    }
+    shard.tasks.push_back(std::move(task));
+    if(shard.tasks.size() == 1)
+    {
+        shard.condVar.notify_one();
+    }
+}
+
+void
+PublishShards::destroy()
+{
+    for(const auto& shard : _shards)
+    {
+        lock_guard<mutex> lg(shard->mutex);
+        shard->destroyed = true;
+        shard->condVar.notify_one();
+        shard->notFull.notify_all();
+    }
+    for(const auto& shard : _shards)
+    {
+        if(shard->thread.joinable())
+        {
+            shard->thread.join();
+        }
+    }
+}
+
+void
+PublishShards::run(Shard& shard)
+{
+    publishShardThread = true;
+    while(true)
+    {
+        deque<function<void()>> tasks;
+        {
+            unique_lock<mutex> lock(shard.mutex);
+            shard.condVar.wait(lock, [&shard] { return shard.destroyed || !shard.tasks.empty(); });
+            if(shard.tasks.empty())
+            {
+                return; // Destroyed and all the tasks are done.
+            }
+            tasks.swap(shard.tasks);
+            shard.notFull.notify_all();
+        }
+
+        for(const auto& task : tasks)
+        {
+            try
+            {
+                task();
+            }
+            catch(const std::exception& ex)
+            {
+                Ice::Warning warn(_logger);
+                warn << "unexpected exception while publishing events:\n" << ex;
+            }
+        }
+    }
+}
+
 Instance::Instance(const string& instanceName,
                    const string& name,
                    shared_ptr<Ice::Communicator> communicator,
@@ -63,6 +203,12 @@ Instance::Instance(const string& instanceName,
     _sendTimeout(_communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.Timeout", 60 * 1000)),
     _sendQueueSizeMax(_communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.QueueSizeMax", -1)),
     _sendQueueSizeMaxPolicy(RemoveSubscriber),
+    _spillPath(_communicator->getProperties()->getProperty(name + ".Send.Spill.Path")),
+    // default 100MB per subscriber.
+    _spillSizeMax(static_cast<size_t>(
+        max(_communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.Spill.SizeMax", 102400), 0)) * 1024),
+    // default no age limit.
+    _spillAgeMax(_communicator->getProperties()->getPropertyAsIntWithDefault(name + ".Send.Spill.AgeMax", 0)),
     _topicReaper(make_shared<TopicReaper>()),
     _observers(make_shared<Observers>(_traceLevels))
 {
@@ -87,6 +233,20 @@ Instance::Instance(const string& instanceName,
 
         _timer = make_shared<IceUtil::Timer>();
 
+        //
+        // By default the events are queued to the subscribers by the thread
+        // dispatching the publish request.
+        //
+        int shards = properties->getPropertyAsIntWithDefault(name + ".Fanout.Shards", 0);
+        if(shards > 1)
+        {
+            // By default, a shard queues up to 1000 publish calls, 0 means unlimited.
+            int queueSizeMax = properties->getPropertyAsIntWithDefault(name + ".Fanout.QueueSizeMax", 1000);
+            _publishShards = make_shared<PublishShards>(static_cast<size_t>(shards),
+                                                        static_cast<size_t>(max(queueSizeMax, 0)),
+                                                        _traceLevels->logger);
+        }
+
         string policy = properties->getProperty(name + ".Send.QueueSizeMaxPolicy");
         if(policy == "RemoveSubscriber")
         {
@@ -96,6 +256,21 @@ Instance::Instance(const string& instanceName,
         {
             const_cast<SendQueueSizeMaxPolicy&>(_sendQueueSizeMaxPolicy) = DropEvents;
         }
+        else if(policy == "SpillToDisk")
+        {
+            //
+            // The spill directory must be set, there's no default directory.
+            //
+            if(_spillPath.empty())
+            {
+                Ice::Warning warn(_traceLevels->logger);
+                warn << "`" << name << ".Send.Spill.Path' is not set, using the RemoveSubscriber policy";
+            }
+            else
+            {
+                const_cast<SendQueueSizeMaxPolicy&>(_sendQueueSizeMaxPolicy) = SpillToDisk;
+            }
+        }
         else if(!policy.empty())
         {
             Ice::Warning warn(_traceLevels->logger);
@@ -226,6 +401,22 @@ Instance::topicReaper() const
     return _topicReaper;
 }
 
+shared_ptr<PublishShards>
+Instance::publishShards() const
+{
+    return _publishShards;
+}
+
+SubscriberShards
+Instance::partitionSubscribers(const vector<shared_ptr<Subscriber>>& subscribers) const
+{
+    if(_publishShards)
+    {
+        return _publishShards->partition(subscribers);
+    }
+    return SubscriberShards(1, subscribers);
+}
+
 chrono::seconds
 Instance::discardInterval() const
 {
@@ -256,6 +447,24 @@ Instance::sendQueueSizeMaxPolicy() const
     return _sendQueueSizeMaxPolicy;
 }
 
+string
+Instance::spillPath() const
+{
+    return _spillPath;
+}
+
+size_t
+Instance::spillSizeMax() const
+{
+    return _spillSizeMax;
+}
+
+chrono::seconds
+Instance::spillAgeMax() const
+{
+    return _spillAgeMax;
+}
+
 void
 Instance::shutdown()
 {
@@ -269,6 +478,15 @@ Instance::shutdown()
     _topicAdapter->destroy();
     _publishAdapter->destroy();
 
+    //
+    // Once the publish adapter is destroyed no more events are published,
+    // wait for the events already published to be queued to the subscribers.
+    //
+    if(_publishShards)
+    {
+        _publishShards->destroy();
+    }
+
     if(_timer)
     {
         _timer->destroy();
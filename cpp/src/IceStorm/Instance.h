@@ -12,6 +12,10 @@
 #include <IceStorm/Instrumentation.h>
 #include <IceStorm/Util.h>
 
+#include <atomic>
+#include <deque>
+#include <thread>
+
 namespace IceStormElection
 {
 
@@ -24,6 +28,7 @@ namespace IceStorm
 {
 
 class TraceLevels;
+class Subscriber;
 
 class TopicReaper
 {
@@ -39,6 +44,52 @@ private:
     std::mutex _mutex;
 };
 
+//
+// The subscribers of a topic split in shards, each shard is queued the
+// published events by the same publish shard thread.
+//
+using SubscriberShards = std::vector<std::vector<std::shared_ptr<Subscriber>>>;
+
+//
+// A fixed set of threads queuing published events to the subscribers of the
+// topics. The tasks of a shard are run in order by the shard's thread so a
+// subscriber, which is always assigned to the same shard, is queued the
+// events in the order they're published. The task queue of a shard is
+// bounded, a publisher dispatching to a full shard waits for the shard's
+// thread to catch up.
+//
+class PublishShards
+{
+public:
+
+    PublishShards(size_t, size_t, std::shared_ptr<Ice::Logger>);
+    ~PublishShards();
+
+    size_t size() const;
+    SubscriberShards partition(const std::vector<std::shared_ptr<Subscriber>>&) const;
+    void dispatch(size_t, std::function<void()>);
+    void destroy();
+
+private:
+
+    struct Shard
+    {
+        std::mutex mutex;
+        std::condition_variable condVar;
+        std::condition_variable notFull;
+        std::deque<std::function<void()>> tasks;
+        bool destroyed = false;
+        std::thread thread;
+    };
+
+    void run(Shard&);
+
+    const size_t _queueSizeMax;
+    const std::shared_ptr<Ice::Logger> _logger;
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic<size_t> _dropped;
+};
+
 class Instance
 {
 public:
@@ -46,7 +97,8 @@ public:
     enum SendQueueSizeMaxPolicy
     {
         RemoveSubscriber,
-        DropEvents
+        DropEvents,
+        SpillToDisk
     };
 
     Instance(const std::string&, const std::string&, std::shared_ptr<Ice::Communicator>,
@@ -74,12 +126,17 @@ public:
     Ice::ObjectPrxPtr publisherReplicaProxy() const;
     std::shared_ptr<IceStorm::Instrumentation::TopicManagerObserver> observer() const;
     std::shared_ptr<TopicReaper> topicReaper() const;
+    std::shared_ptr<PublishShards> publishShards() const;
+    SubscriberShards partitionSubscribers(const std::vector<std::shared_ptr<Subscriber>>&) const;
 
     std::chrono::seconds discardInterval() const;
     std::chrono::milliseconds flushInterval() const;
     std::chrono::milliseconds sendTimeout() const;
     int sendQueueSizeMax() const;
     SendQueueSizeMaxPolicy sendQueueSizeMaxPolicy() const;
+    std::string spillPath() const;
+    size_t spillSizeMax() const;
+    std::chrono::seconds spillAgeMax() const;
 
     void shutdown();
     virtual void destroy();
@@ -99,9 +156,13 @@ private:
     const std::chrono::milliseconds _sendTimeout;
     const int _sendQueueSizeMax;
     const SendQueueSizeMaxPolicy _sendQueueSizeMaxPolicy;
+    const std::string _spillPath;
+    const size_t _spillSizeMax;
+    const std::chrono::seconds _spillAgeMax;
     const Ice::ObjectPrxPtr _topicReplicaProxy;
     const Ice::ObjectPrxPtr _publisherReplicaProxy;
     const std::shared_ptr<TopicReaper> _topicReaper;
+    std::shared_ptr<PublishShards> _publishShards;
     std::shared_ptr<IceStormElection::NodeI> _node;
     std::shared_ptr<IceStormElection::Observers> _observers;
     IceUtil::TimerPtr _timer;
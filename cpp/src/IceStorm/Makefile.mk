@@ -19,6 +19,7 @@ IceStormService_sources         := $(addprefix $(currentdir)/,Instance.cpp \
                                                              Observers.cpp \
                                                              Service.cpp \
                                                              SendQueueSizeMaxReached.cpp \
+                                                             SpillQueue.cpp \
                                                              Subscriber.cpp \
                                                              TopicI.cpp \
                                                              TopicManagerI.cpp \
@@ -458,6 +458,8 @@ ServiceI::validateProperties(const string& name, const shared_ptr<Properties>& p
         "Transient",
         "NodeId",
         "Flush.Timeout",
+        "Fanout.Shards",
+        "Fanout.QueueSizeMax",
         "InstanceName",
         "Election.MasterTimeout",
         "Election.ElectionTimeout",
@@ -508,6 +510,9 @@ ServiceI::validateProperties(const string& name, const shared_ptr<Properties>& p
         "Send.Timeout",
         "Send.QueueSizeMax",
         "Send.QueueSizeMaxPolicy",
+        "Send.Spill.Path",
+        "Send.Spill.SizeMax",
+        "Send.Spill.AgeMax",
         "Discard.Interval",
         "LMDB.Path",
         "LMDB.MapSize"
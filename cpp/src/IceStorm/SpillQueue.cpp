@@ -0,0 +1,216 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <IceStorm/SpillQueue.h>
+#include <IceStorm/Instance.h>
+#include <IceStorm/TraceLevels.h>
+#include <IceUtil/FileUtil.h>
+#include <IceUtil/StringUtil.h>
+#include <IceUtil/UUID.h>
+
+using namespace std;
+using namespace IceStorm;
+
+namespace
+{
+
+int64_t
+now()
+{
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}
+
+SpillQueue::SpillQueue(const shared_ptr<Instance>& instance) :
+    _instance(instance),
+    _path(instance->spillPath() + "/" + IceUtil::generateUUID() + ".spill"),
+    _file(nullptr),
+    _readPos(0),
+    _writePos(0),
+    _filePos(-1),
+    _fileWrite(false)
+{
+}
+
+SpillQueue::~SpillQueue()
+{
+    if(_file)
+    {
+        fclose(_file);
+        IceUtilInternal::remove(_path);
+    }
+}
+
+bool
+SpillQueue::empty() const
+{
+    return _readPos == _writePos;
+}
+
+bool
+SpillQueue::push(const EventDataPtr& event)
+{
+    //
+    // Each event is stored with the time it was queued, preceded by its size.
+    //
+    Ice::OutputStream out(_instance->communicator());
+    out.write(now());
+    out.write(*event);
+    vector<Ice::Byte> bytes;
+    out.finished(bytes);
+
+    //
+    // The limit applies to the events in the queue, not to the events already read.
+    //
+    int32_t size = static_cast<int32_t>(bytes.size());
+    if(static_cast<size_t>(_writePos - _readPos) + sizeof(size) + bytes.size() > _instance->spillSizeMax())
+    {
+        return false;
+    }
+
+    if(!_file)
+    {
+        IceUtilInternal::mkdir(_instance->spillPath(), 0777); // Ignore errors, it can already exist.
+        _file = IceUtilInternal::fopen(_path, "w+b");
+        if(!_file)
+        {
+            Ice::Warning warn(_instance->traceLevels()->logger);
+            warn << "cannot open spill file `" << _path << "':\n" << IceUtilInternal::lastErrorToString();
+            return false;
+        }
+    }
+
+    if(!seek(_writePos, true) ||
+       fwrite(&size, sizeof(size), 1, _file) != 1 ||
+       fwrite(bytes.data(), bytes.size(), 1, _file) != 1)
+    {
+        Ice::Warning warn(_instance->traceLevels()->logger);
+        warn << "cannot write to spill file `" << _path << "':\n" << IceUtilInternal::lastErrorToString();
+        _filePos = -1;
+        return false;
+    }
+    _writePos += static_cast<long>(sizeof(size) + bytes.size());
+    _filePos = _writePos;
+    return true;
+}
+
+size_t
+SpillQueue::pop(EventDataPtrSeq& events, size_t max)
+{
+    const int64_t ageMax = chrono::duration_cast<chrono::milliseconds>(_instance->spillAgeMax()).count();
+    const int64_t time = now();
+
+    size_t discarded = 0;
+    vector<Ice::Byte> bytes;
+    while(max > 0 && _readPos < _writePos)
+    {
+        int32_t size;
+        if(!seek(_readPos, false) || fread(&size, sizeof(size), 1, _file) != 1 || size <= 0)
+        {
+            _filePos = -1;
+            break;
+        }
+        bytes.resize(static_cast<size_t>(size));
+        if(fread(bytes.data(), bytes.size(), 1, _file) != 1)
+        {
+            _filePos = -1;
+            break;
+        }
+        _readPos += static_cast<long>(sizeof(size) + bytes.size());
+        _filePos = _readPos;
+
+        Ice::InputStream in(_instance->communicator(), make_pair(bytes.data(), bytes.data() + bytes.size()));
+        int64_t queued;
+        EventData event;
+        in.read(queued);
+        in.read(event);
+        if(ageMax > 0 && time - queued > ageMax)
+        {
+            ++discarded;
+            continue;
+        }
+        events.push_back(make_shared<const EventData>(std::move(event)));
+        --max;
+    }
+
+    if(max > 0 && _readPos < _writePos)
+    {
+        Ice::Warning warn(_instance->traceLevels()->logger);
+        warn << "cannot read from spill file `" << _path << "':\n" << IceUtilInternal::lastErrorToString();
+        reset();
+    }
+    else if(_readPos == _writePos)
+    {
+        reset(); // Reuse the file from the start.
+    }
+    else if(_readPos >= _writePos - _readPos &&
+            static_cast<size_t>(_readPos) >= _instance->spillSizeMax() / 2)
+    {
+        compact();
+    }
+    return discarded;
+}
+
+void
+SpillQueue::clear()
+{
+    reset();
+}
+
+bool
+SpillQueue::seek(long pos, bool write)
+{
+    //
+    // The file stream must be positioned when switching between reads and writes,
+    // otherwise it's only positioned if needed to keep the stdio buffering.
+    //
+    if(pos != _filePos || write != _fileWrite)
+    {
+        if(fseek(_file, pos, SEEK_SET) != 0)
+        {
+            return false;
+        }
+        _filePos = pos;
+        _fileWrite = write;
+    }
+    return true;
+}
+
+void
+SpillQueue::compact()
+{
+    //
+    // Move the events left to the start of the file. They are copied to the space of
+    // the events already read, which is at least as large, so if the copy fails the
+    // events left are still intact and the queue is left unchanged.
+    //
+    vector<Ice::Byte> buffer(min(static_cast<size_t>(_writePos - _readPos), static_cast<size_t>(64 * 1024)));
+    long from = _readPos;
+    long to = 0;
+    while(from < _writePos)
+    {
+        size_t n = min(buffer.size(), static_cast<size_t>(_writePos - from));
+        if(!seek(from, false) || fread(buffer.data(), n, 1, _file) != 1 ||
+           !seek(to, true) || fwrite(buffer.data(), n, 1, _file) != 1)
+        {
+            Ice::Warning warn(_instance->traceLevels()->logger);
+            warn << "cannot compact spill file `" << _path << "':\n" << IceUtilInternal::lastErrorToString();
+            _filePos = -1;
+            return;
+        }
+        from += static_cast<long>(n);
+        to += static_cast<long>(n);
+        _filePos = to;
+    }
+    _writePos -= _readPos;
+    _readPos = 0;
+}
+
+void
+SpillQueue::reset()
+{
+    _readPos = 0;
+    _writePos = 0;
+}
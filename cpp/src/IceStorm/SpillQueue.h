@@ -0,0 +1,73 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef SPILL_QUEUE_H
+#define SPILL_QUEUE_H
+
+#include <IceStorm/Subscriber.h>
+
+namespace IceStorm
+{
+
+class Instance;
+
+//
+// A queue of events stored in an append-only file. It's used with the
+// SpillToDisk send queue policy to hold the events of a subscriber which
+// don't fit in its queue until the subscriber catches up. The size of the
+// events in the queue is bounded by the spill size limit. The file is
+// reused from the start each time the queue is emptied, and the events
+// are moved to the start of the file once the events already read take
+// more space than the events left, so the file doesn't grow past about
+// twice the size limit. The file is removed with the queue.
+//
+// The queue is used with the subscriber mutex locked, so the file I/O is
+// done by the thread queuing the events. Consecutive events are written
+// and read through the stdio buffer and the file data normally stays in
+// the page cache, but a slow disk slows down the publishing of events to
+// the other subscribers of the topic.
+//
+class SpillQueue
+{
+public:
+
+    SpillQueue(const std::shared_ptr<Instance>&);
+    ~SpillQueue();
+
+    SpillQueue(const SpillQueue&) = delete;
+    SpillQueue& operator=(const SpillQueue&) = delete;
+
+    bool empty() const;
+
+    // Returns false if the queue is full or if the event can't be written.
+    bool push(const EventDataPtr&);
+
+    //
+    // Move up to the given number of events to the back of the event queue.
+    // Events which have been in the queue for longer than the maximum age
+    // are discarded, returns the number of discarded events.
+    //
+    size_t pop(EventDataPtrSeq&, size_t);
+
+    void clear();
+
+private:
+
+    bool seek(long, bool);
+    void compact();
+    void reset();
+
+    const std::shared_ptr<Instance> _instance;
+    const std::string _path;
+
+    FILE* _file;
+    long _readPos;
+    long _writePos;
+    long _filePos; // The position of the file stream, -1 if unknown.
+    bool _fileWrite; // Whether the last file operation was a write.
+};
+
+}
+
+#endif
@@ -4,6 +4,7 @@
 
 #include <IceStorm/Subscriber.h>
 #include <IceStorm/Instance.h>
+#include <IceStorm/SpillQueue.h>
 #include <IceStorm/TraceLevels.h>
 #include <IceStorm/NodeI.h>
 #include <IceStorm/Util.h>
@@ -54,14 +55,13 @@ public:
         // Use cached reads.
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
 
-        EventData event = { current.operation, current.mode, Ice::ByteSeq(), current.ctx };
+        auto event = make_shared<EventData>();
+        event->op = current.operation;
+        event->mode = current.mode;
+        event->data.assign(inParams.first, inParams.second);
+        event->context = current.ctx;
 
-        Ice::ByteSeq data(inParams.first, inParams.second);
-        event.data.swap(data);
-
-        EventDataSeq e;
-        e.push_back(std::move(event));
-        _subscriber->queue(false, std::move(e));
+        _subscriber->queue(false, { std::move(event) });
         return true;
     }
 
@@ -110,6 +110,35 @@ private:
     const Ice::ObjectPrxPtr _obj;
 };
 
+//
+// A oneway subscriber which queues events on its batch proxy. The batch is flushed once
+// it holds batch size events or once the batch latency expires. Up to the given maximum
+// number of flushed batches can be outstanding.
+//
+class SubscriberBatchOneway final : public Subscriber
+{
+public:
+
+    SubscriberBatchOneway(const shared_ptr<Instance>&, const SubscriberRecord&, const Ice::ObjectPrxPtr&, int,
+                          Ice::ObjectPrxPtr, int, chrono::milliseconds, int);
+
+    void flush() override;
+    void shutdown() override;
+    void batchSent(int, bool);
+    void latencyExpired();
+
+private:
+
+    void flushBatch();
+
+    const Ice::ObjectPrxPtr _obj;
+    const int _batchSize;
+    const chrono::milliseconds _latency;
+    int _batched; // The number of events queued on the batch proxy.
+    IceUtil::TimerTaskPtr _flushTask;
+    bool _flushScheduled;
+};
+
 class SubscriberTwoway final : public Subscriber
 {
 public:
@@ -157,19 +186,19 @@ SubscriberOneway::flush()
     //
     // If the subscriber isn't online we're done.
     //
-    if(_state != SubscriberStateOnline || _events.empty())
+    if(_state != SubscriberStateOnline || !pendingEvents())
     {
         return;
     }
 
     // Send up to _maxOutstanding pending events.
-    while(_outstanding < _maxOutstanding && !_events.empty())
+    while(_outstanding < _maxOutstanding && pendingEvents())
     {
         //
         // Dequeue the head event, count one more outstanding AMI
         // request.
         //
-        EventData e = std::move(_events.front());
+        EventDataPtr e = std::move(_events.front());
         _events.pop_front();
         if(_observer)
         {
@@ -182,7 +211,7 @@ SubscriberOneway::flush()
             auto isSent = make_shared<promise<bool>>();
             auto future = isSent->get_future();
 
-            _obj->ice_invokeAsync(e.op, e.mode, e.data, nullptr,
+            _obj->ice_invokeAsync(e->op, e->mode, e->data, nullptr,
                 [self](exception_ptr ex)
                 {
                     self->error(true, ex);
@@ -195,7 +224,7 @@ SubscriberOneway::flush()
                         self->sentAsynchronously();
                     }
                 },
-                e.context);
+                e->context);
 
             //
             // Check if the request is (or potentially was) sent asynchronously
@@ -245,12 +274,209 @@ SubscriberOneway::sentAsynchronously()
     {
         _condVar.notify_one();
     }
-    else if(_outstanding <= 0 && !_events.empty())
+    else if(_outstanding <= 0 && pendingEvents())
     {
         flush();
     }
 }
 
+namespace
+{
+
+class BatchFlushTask : public IceUtil::TimerTask
+{
+public:
+
+    BatchFlushTask(const shared_ptr<SubscriberBatchOneway>& subscriber) : _subscriber(subscriber)
+    {
+    }
+
+    void
+    runTimerTask() override
+    {
+        auto subscriber = _subscriber.lock();
+        if(subscriber)
+        {
+            subscriber->latencyExpired();
+        }
+    }
+
+private:
+
+    const weak_ptr<SubscriberBatchOneway> _subscriber;
+};
+
+}
+
+SubscriberBatchOneway::SubscriberBatchOneway(const shared_ptr<Instance>& instance,
+                                             const SubscriberRecord& rec,
+                                             const Ice::ObjectPrxPtr& proxy,
+                                             int retryCount,
+                                             Ice::ObjectPrxPtr obj,
+                                             int batchSize,
+                                             chrono::milliseconds latency,
+                                             int maxOutstanding) :
+    Subscriber(instance, rec, proxy, retryCount, maxOutstanding),
+    _obj(std::move(obj)),
+    _batchSize(batchSize),
+    _latency(latency),
+    _batched(0),
+    _flushScheduled(false)
+{
+}
+
+void
+SubscriberBatchOneway::flush()
+{
+    lock_guard<recursive_mutex> lg(_mutex);
+
+    //
+    // If the subscriber isn't online we're done.
+    //
+    if(_state != SubscriberStateOnline)
+    {
+        return;
+    }
+
+    //
+    // Queue the events on the batch proxy and flush each full batch, up to
+    // _maxOutstanding batches are sent concurrently.
+    //
+    while(_outstanding < _maxOutstanding && pendingEvents())
+    {
+        EventDataPtr e = std::move(_events.front());
+        _events.pop_front();
+        try
+        {
+            vector<Ice::Byte> outParams;
+            _obj->ice_invoke(e->op, e->mode, e->data, outParams, e->context);
+        }
+        catch(const std::exception&)
+        {
+            error(false, current_exception());
+            return;
+        }
+
+        if(++_batched >= _batchSize)
+        {
+            flushBatch();
+        }
+    }
+
+    //
+    // Flush the remaining events once the latency expires, or now if the
+    // subscriber is shutting down.
+    //
+    if(_batched > 0 && _state == SubscriberStateOnline)
+    {
+        if(_shutdown)
+        {
+            flushBatch();
+        }
+        else if(!_flushScheduled)
+        {
+            if(!_flushTask)
+            {
+                _flushTask = make_shared<BatchFlushTask>(static_pointer_cast<SubscriberBatchOneway>(shared_from_this()));
+            }
+
+            try
+            {
+                _instance->timer()->schedule(_flushTask, _latency);
+                _flushScheduled = true;
+            }
+            catch(const IceUtil::IllegalArgumentException&)
+            {
+                flushBatch(); // The timer is destroyed.
+            }
+        }
+    }
+}
+
+void
+SubscriberBatchOneway::shutdown()
+{
+    {
+        lock_guard<recursive_mutex> lg(_mutex);
+        _shutdown = true;
+        flush(); // Flush the partial batch now instead of once the latency expires.
+    }
+    Subscriber::shutdown();
+}
+
+void
+SubscriberBatchOneway::flushBatch()
+{
+    // Called with the mutex locked.
+    assert(_batched > 0);
+    int count = _batched;
+    _batched = 0;
+
+    ++_outstanding;
+    if(_observer)
+    {
+        _observer->outstanding(count);
+    }
+
+    try
+    {
+        auto self = static_pointer_cast<SubscriberBatchOneway>(shared_from_this());
+        _obj->ice_flushBatchRequestsAsync(
+            [self](exception_ptr ex)
+            {
+                self->error(true, ex);
+            },
+            [self, count](bool sentSynchronously)
+            {
+                self->batchSent(count, sentSynchronously);
+            });
+    }
+    catch(const std::exception&)
+    {
+        error(true, current_exception());
+    }
+}
+
+void
+SubscriberBatchOneway::batchSent(int count, bool sentSynchronously)
+{
+    lock_guard<recursive_mutex> lg(_mutex);
+
+    // Decrement the _outstanding count.
+    --_outstanding;
+    assert(_outstanding >= 0 && _outstanding < _maxOutstanding);
+    if(_observer)
+    {
+        _observer->delivered(count);
+    }
+
+    //
+    // A sent batch means we're no longer retrying, we're back active.
+    //
+    _currentRetry = 0;
+
+    if(_events.empty() && _outstanding == 0 && _shutdown)
+    {
+        _condVar.notify_one();
+    }
+    else if(!sentSynchronously && pendingEvents())
+    {
+        flush(); // Otherwise, flush() is still queuing the events.
+    }
+}
+
+void
+SubscriberBatchOneway::latencyExpired()
+{
+    lock_guard<recursive_mutex> lg(_mutex);
+
+    _flushScheduled = false;
+    if(_batched > 0 && _state == SubscriberStateOnline)
+    {
+        flushBatch();
+    }
+}
+
 SubscriberTwoway::SubscriberTwoway(const shared_ptr<Instance>& instance,
                                    const SubscriberRecord& rec,
                                    const Ice::ObjectPrxPtr& proxy,
@@ -270,19 +496,19 @@ SubscriberTwoway::flush()
     //
     // If the subscriber isn't online we're done.
     //
-    if(_state != SubscriberStateOnline || _events.empty())
+    if(_state != SubscriberStateOnline || !pendingEvents())
     {
         return;
     }
 
     // Send up to _maxOutstanding pending events.
-    while(_outstanding < _maxOutstanding && !_events.empty())
+    while(_outstanding < _maxOutstanding && pendingEvents())
     {
         //
         // Dequeue the head event, count one more outstanding AMI
         // request.
         //
-        EventData e = std::move(_events.front());
+        EventDataPtr e = std::move(_events.front());
         _events.pop_front();
 
         ++_outstanding;
@@ -295,7 +521,7 @@ SubscriberTwoway::flush()
         try
         {
             auto self = static_pointer_cast<SubscriberTwoway>(shared_from_this());
-            _obj->ice_invokeAsync(e.op, e.mode, e.data,
+            _obj->ice_invokeAsync(e->op, e->mode, e->data,
                 [self](bool, vector<Ice::Byte>)
                 {
                     self->completed();
@@ -304,7 +530,7 @@ SubscriberTwoway::flush()
                 {
                     self->error(true, ex);
                 },
-                nullptr, e.context);
+                nullptr, e->context);
         }
         catch(const std::exception&)
         {
@@ -335,17 +561,23 @@ SubscriberLink::flush()
         return;
     }
 
-    EventDataSeq v;
-    v.swap(_events);
+    pendingEvents(); // Reload the spilled events, if any.
 
-    auto p = v.begin();
-    while(p != v.end())
+    EventDataPtrSeq events;
+    events.swap(_events);
+
+    //
+    // The forwarded events are copied from the shared events, the events which cost
+    // more than the link cost are not forwarded.
+    //
+    EventDataSeq v;
+    for(const auto& e : events)
     {
         if(_rec.cost != 0)
         {
             int cost = 0;
-            auto q = p->context.find("cost");
-            if(q != p->context.end())
+            auto q = e->context.find("cost");
+            if(q != e->context.end())
             {
                 try
                 {
@@ -358,11 +590,10 @@ SubscriberLink::flush()
             }
             if(cost > _rec.cost)
             {
-                p = v.erase(p);
                 continue;
             }
         }
-        ++p;
+        v.push_back(*e);
     }
 
     if(!v.empty())
@@ -396,6 +627,31 @@ SubscriberLink::flush()
 
 }
 
+EventDataPtrSeq
+IceStorm::shareEvents(EventDataSeq events)
+{
+    EventDataPtrSeq v;
+    for(auto& e : events)
+    {
+        v.push_back(make_shared<const EventData>(std::move(e)));
+    }
+    return v;
+}
+
+Ice::IdentitySeq
+IceStorm::queueEvents(bool forwarded, const EventDataPtrSeq& events, const vector<shared_ptr<Subscriber>>& subscribers)
+{
+    Ice::IdentitySeq reap;
+    for(const auto& subscriber : subscribers)
+    {
+        if(!subscriber->queue(forwarded, events) && subscriber->reap())
+        {
+            reap.push_back(subscriber->id());
+        }
+    }
+    return reap;
+}
+
 shared_ptr<Subscriber>
 Subscriber::create(const shared_ptr<Instance>& instance,
                    const SubscriberRecord& rec)
@@ -477,6 +733,50 @@ Subscriber::create(const shared_ptr<Instance>& instance,
                 newObj = newObj->ice_connectionCached(connectionCached > 0);
             }
 
+            int batchSize = 0;
+            p = rec.theQoS.find("batch");
+            if(p != rec.theQoS.end())
+            {
+                istringstream is(IceUtilInternal::trim(p->second));
+                if(!(is >> batchSize) || !is.eof() || batchSize < 1)
+                {
+                    throw BadQoS("invalid batch size (positive numeric value required): " + p->second);
+                }
+            }
+
+            chrono::milliseconds latency = instance->flushInterval();
+            p = rec.theQoS.find("latency");
+            if(p != rec.theQoS.end())
+            {
+                istringstream is(IceUtilInternal::trim(p->second));
+                int ms;
+                if(!(is >> ms) || !is.eof() || ms < 0)
+                {
+                    throw BadQoS("invalid batch latency (numeric value required): " + p->second);
+                }
+                if(batchSize == 0)
+                {
+                    throw BadQoS("batch latency requires a batch size");
+                }
+                latency = chrono::milliseconds(ms);
+            }
+
+            int maxOutstanding = 5;
+            p = rec.theQoS.find("maxOutstanding");
+            if(p != rec.theQoS.end())
+            {
+                istringstream is(IceUtilInternal::trim(p->second));
+                if(!(is >> maxOutstanding) || !is.eof() || maxOutstanding < 1)
+                {
+                    throw BadQoS("invalid maximum outstanding batches (positive numeric value required): " +
+                                 p->second);
+                }
+                if(batchSize == 0)
+                {
+                    throw BadQoS("maximum outstanding batches requires a batch size");
+                }
+            }
+
             if(newObj->ice_isBatchOneway())
             {
                 // Use Oneway in case of Batch Oneway
@@ -488,7 +788,17 @@ Subscriber::create(const shared_ptr<Instance>& instance,
                 newObj = newObj->ice_datagram();
             }
 
-            if(reliability == "ordered")
+            if(batchSize > 0)
+            {
+                if(reliability == "ordered" || newObj->ice_isTwoway())
+                {
+                    throw BadQoS("batch requires a oneway or datagram proxy");
+                }
+                newObj = newObj->ice_isDatagram() ? newObj->ice_batchDatagram() : newObj->ice_batchOneway();
+                subscriber = make_shared<SubscriberBatchOneway>(instance, rec, proxy, retryCount, newObj, batchSize,
+                                                                latency, maxOutstanding);
+            }
+            else if(reliability == "ordered")
             {
                 if(!newObj->ice_isTwoway())
                 {
@@ -536,7 +846,7 @@ Subscriber::record() const
 }
 
 bool
-Subscriber::queue(bool forwarded, const EventDataSeq& events)
+Subscriber::queue(bool forwarded, const EventDataPtrSeq& events)
 {
     lock_guard<recursive_mutex> lg(_mutex);
 
@@ -566,8 +876,22 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
 
     case SubscriberStateOnline:
     {
-        for(EventDataSeq::const_iterator p = events.begin(); p != events.end(); ++p)
+        for(EventDataPtrSeq::const_iterator p = events.begin(); p != events.end(); ++p)
         {
+            //
+            // Once events are spilled to disk, the following events are also spilled
+            // until the spilled events are reloaded to keep the events in order.
+            //
+            if(_spill && !_spill->empty())
+            {
+                if(!_spill->push(*p))
+                {
+                    error(false, make_exception_ptr(SendQueueSizeMaxReached(__FILE__, __LINE__)));
+                    return false;
+                }
+                continue;
+            }
+
             if(static_cast<int>(_events.size()) == _instance->sendQueueSizeMax())
             {
                 if(_instance->sendQueueSizeMaxPolicy() == Instance::RemoveSubscriber)
@@ -575,6 +899,19 @@ Subscriber::queue(bool forwarded, const EventDataSeq& events)
                     error(false, make_exception_ptr(SendQueueSizeMaxReached(__FILE__, __LINE__)));
                     return false;
                 }
+                else if(_instance->sendQueueSizeMaxPolicy() == Instance::SpillToDisk)
+                {
+                    if(!_spill)
+                    {
+                        _spill = make_unique<SpillQueue>(_instance);
+                    }
+                    if(!_spill->push(*p))
+                    {
+                        error(false, make_exception_ptr(SendQueueSizeMaxReached(__FILE__, __LINE__)));
+                        return false;
+                    }
+                    continue;
+                }
                 else // DropEvents
                 {
                     _events.pop_front();
@@ -794,12 +1131,20 @@ Subscriber::error(bool dec, exception_ptr e)
         _next = now + _instance->discardInterval();
         ++_currentRetry;
         _events.clear();
+        if(_spill)
+        {
+            _spill->clear();
+        }
         setState(SubscriberStateOffline);
     }
     // Errored out.
     else if(_state < SubscriberStateError)
     {
         _events.clear();
+        if(_spill)
+        {
+            _spill->clear();
+        }
         setState(SubscriberStateError);
 
         auto traceLevels = _instance->traceLevels();
@@ -888,6 +1233,11 @@ Subscriber::Subscriber(shared_ptr<Instance> instance,
     }
 }
 
+Subscriber::~Subscriber()
+{
+    // Out of line to destroy the spill queue.
+}
+
 namespace
 {
 
@@ -911,6 +1261,27 @@ stateToString(Subscriber::SubscriberState state)
 
 }
 
+bool
+Subscriber::pendingEvents()
+{
+    //
+    // The spilled events are reloaded once the queue is empty, up to the
+    // maximum queue size.
+    //
+    if(_events.empty() && _spill && !_spill->empty())
+    {
+        size_t discarded = _spill->pop(_events, static_cast<size_t>(max(_instance->sendQueueSizeMax(), 1)));
+        auto traceLevels = _instance->traceLevels();
+        if(discarded > 0 && traceLevels->subscriber > 0)
+        {
+            Ice::Trace out(traceLevels->logger, traceLevels->subscriberCat);
+            out << _instance->communicator()->identityToString(_rec.id) << " discarded " << discarded
+                << " spilled events older than " << _instance->spillAgeMax().count() << "s";
+        }
+    }
+    return !_events.empty();
+}
+
 void
 Subscriber::setState(Subscriber::SubscriberState state)
 {
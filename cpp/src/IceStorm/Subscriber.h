@@ -17,10 +17,23 @@ namespace IceStorm
 
 class Instance;
 
+//
+// The events published to a topic are immutable, they are shared by the queues of
+// the topic subscribers instead of being copied for each subscriber.
+//
+using EventDataPtr = std::shared_ptr<const EventData>;
+using EventDataPtrSeq = std::deque<EventDataPtr>;
+
+EventDataPtrSeq shareEvents(EventDataSeq);
+
+class SpillQueue;
+
 class Subscriber : public std::enable_shared_from_this<Subscriber>
 {
 public:
 
+    virtual ~Subscriber();
+
     static std::shared_ptr<Subscriber> create(const std::shared_ptr<Instance>&, const IceStorm::SubscriberRecord&);
 
     Ice::ObjectPrxPtr proxy() const; // Get the per subscriber object.
@@ -28,7 +41,7 @@ public:
     IceStorm::SubscriberRecord record() const; // Get the subscriber record.
 
     // Returns false if the subscriber should be reaped.
-    bool queue(bool, const EventDataSeq&);
+    bool queue(bool, const EventDataPtrSeq&);
     bool reap();
     void resetIfReaped();
     bool errored() const;
@@ -39,7 +52,7 @@ public:
     void completed();
     void error(bool, std::exception_ptr);
 
-    void shutdown();
+    virtual void shutdown();
 
     void updateObserver();
 
@@ -56,6 +69,7 @@ public:
 protected:
 
     void setState(SubscriberState);
+    bool pendingEvents(); // Returns true if there are events to send, must be called with _mutex locked.
 
     Subscriber(std::shared_ptr<Instance>, IceStorm::SubscriberRecord, Ice::ObjectPrxPtr, int, int);
 
@@ -76,7 +90,8 @@ protected:
 
     int _outstanding; // The current number of outstanding responses.
     int _outstandingCount; // The current number of outstanding events when batching events (only used for metrics).
-    EventDataSeq _events; // The queue of events to send.
+    EventDataPtrSeq _events; // The queue of events to send.
+    std::unique_ptr<SpillQueue> _spill; // The events which don't fit in the queue, with SpillToDisk.
 
     // The next time to try sending a new event if we're offline.
     std::chrono::steady_clock::time_point _next;
@@ -90,6 +105,9 @@ bool operator==(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 bool operator!=(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 bool operator<(const IceStorm::Subscriber&, const IceStorm::Subscriber&);
 
+// Queue the events to the subscribers, returns the ids of the subscribers to reap.
+Ice::IdentitySeq queueEvents(bool, const EventDataPtrSeq&, const std::vector<std::shared_ptr<Subscriber>>&);
+
 }
 
 #endif // SUBSCRIBER_H
@@ -53,7 +53,7 @@ public:
 
         EventDataSeq v;
         v.push_back(std::move(event));
-        _topic->publish(false, v);
+        _topic->publish(false, std::move(v));
 
         return true;
     }
@@ -427,6 +427,7 @@ TopicImpl::TopicImpl(shared_ptr<PersistentInstance> instance,
         {
             _observer.attach(_instance->observer()->getTopicObserver(_instance->serviceName(), _name, nullptr));
         }
+        updatePublishState();
     }
     catch(const std::exception&)
     {
@@ -562,6 +563,7 @@ TopicImpl::subscribeAndGetPublisher(QoS qos, Ice::ObjectPrxPtr obj)
     }
 
     _subscribers.push_back(subscriber);
+    updatePublishState();
 
     _instance->observers()->addSubscriber(llu, _name, record);
 
@@ -671,6 +673,7 @@ TopicImpl::link(const TopicPrxPtr& topic, int cost)
     }
 
     _subscribers.push_back(subscriber);
+    updatePublishState();
 
     _instance->observers()->addSubscriber(llu, _name, record);
 }
@@ -750,6 +753,7 @@ TopicImpl::shutdown()
     }
 
     _observer.detach();
+    updatePublishState();
 }
 
 LinkInfoSeq
@@ -809,6 +813,7 @@ TopicImpl::destroy()
     _instance->observers()->destroyTopic(destroyInternal(llu, true), _name);
 
     _observer.detach();
+    updatePublishState();
 }
 
 TopicContent
@@ -885,6 +890,7 @@ TopicImpl::update(const SubscriberRecordSeq& records)
             _subscribers.push_back(subscriber);
         }
     }
+    updatePublishState();
 }
 
 bool
@@ -919,54 +925,99 @@ TopicImpl::proxy() const
 }
 
 void
-TopicImpl::publish(bool forwarded, const EventDataSeq& events)
+TopicImpl::updatePublishState()
 {
-    TopicInternalPrxPtr masterInternal;
-    int64_t generation = -1;
+    auto state = make_shared<PublishState>();
+    state->shards = _instance->partitionSubscribers(_subscribers);
+    state->observer = _observer.get();
+    atomic_store(&_publishState, shared_ptr<const PublishState>(std::move(state)));
+}
+
+void
+TopicImpl::publish(bool forwarded, EventDataSeq v)
+{
+    //
+    // The events are shared by the queues of all the subscribers.
+    //
+    auto events = make_shared<const EventDataPtrSeq>(shareEvents(std::move(v)));
+
+    auto publishShards = _instance->publishShards();
+    shared_ptr<const PublishState> state;
     Ice::IdentitySeq reap;
     {
         // Use cached reads.
         CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
 
         //
-        // Copy of the subscriber list so that event publishing can occur
-        // in parallel.
+        // Load the subscribers without locking so that event publishing can occur
+        // in parallel and doesn't contend with subscriber updates.
         //
-        vector<shared_ptr<Subscriber>> copy;
+        state = atomic_load(&_publishState);
+        if(state->observer)
         {
-            lock_guard<mutex> lock(_subscribersMutex);
-
-            if(_observer)
+            if(forwarded)
             {
-                if(forwarded)
-                {
-                    _observer->forwarded();
-                }
-                else
-                {
-                    _observer->published();
-                }
+                state->observer->forwarded();
+            }
+            else
+            {
+                state->observer->published();
             }
-            copy = _subscribers;
         }
 
         //
         // Queue each event, gathering a list of those subscribers that
         // must be reaped.
         //
-        for(const auto& subscriber : copy)
+        if(!publishShards)
         {
-            if(!subscriber->queue(forwarded, events) && subscriber->reap())
-            {
-                reap.push_back(subscriber->id());
-            }
+            reap = queueEvents(forwarded, *events, state->shards[0]);
         }
+    }
 
-        // If there are no subscribers in error then we're done.
-        if(reap.empty())
+    //
+    // With publish shards, the events are queued to each shard of subscribers
+    // by the shard thread which also reaps the subscribers in error. A shard
+    // thread queues the events in the order they're dispatched to it, so the
+    // events published by a publisher are queued in order. The events are
+    // dispatched outside the cached read: the dispatch blocks while the shard
+    // queue is full and the shard thread needs cached reads to reap subscribers.
+    //
+    if(publishShards)
+    {
+        auto self = shared_from_this();
+        for(size_t i = 0; i < state->shards.size(); ++i)
         {
-            return;
+            if(!state->shards[i].empty())
+            {
+                publishShards->dispatch(i, [self, state, events, forwarded, i]
+                {
+                    Ice::IdentitySeq shardReap = queueEvents(forwarded, *events, state->shards[i]);
+                    if(!shardReap.empty())
+                    {
+                        self->reapSubscribers(shardReap);
+                    }
+                });
+            }
         }
+        return;
+    }
+
+    // If there are no subscribers in error then we're done.
+    if(!reap.empty())
+    {
+        reapSubscribers(reap);
+    }
+}
+
+void
+TopicImpl::reapSubscribers(const Ice::IdentitySeq& reap)
+{
+    TopicInternalPrxPtr masterInternal;
+    int64_t generation = -1;
+    {
+        // Use cached reads.
+        CachedReadHelper unlock(_instance->node(), __FILE__, __LINE__);
         if(!unlock.getMaster())
         {
             lock_guard<mutex> lock(_subscribersMutex);
@@ -1068,6 +1119,7 @@ TopicImpl::observerAddSubscriber(const LogUpdate& llu, const SubscriberRecord& r
     }
 
     _subscribers.push_back(subscriber);
+    updatePublishState();
 }
 
 void
@@ -1124,6 +1176,7 @@ TopicImpl::observerRemoveSubscriber(const LogUpdate& llu, const Ice::IdentitySeq
             _subscribers.erase(p);
         }
     }
+    updatePublishState();
 }
 
 void
@@ -1161,6 +1214,7 @@ TopicImpl::updateObserver()
     if(_instance->observer())
     {
         _observer.attach(_instance->observer()->getTopicObserver(_instance->serviceName(), _name, _observer.get()));
+        updatePublishState();
     }
 }
 
@@ -1231,6 +1285,7 @@ TopicImpl::destroyInternal(const LogUpdate& origLLU, bool master)
         subscriber->destroy();
     }
     _subscribers.clear();
+    updatePublishState();
 
     _instance->topicAdapter()->remove(_id);
 
@@ -1293,6 +1348,7 @@ TopicImpl::removeSubscribers(const Ice::IdentitySeq& ids)
                 _subscribers.erase(p);
             }
         }
+        updatePublishState();
 
         _instance->observers()->removeSubscriber(llu, _name, ids);
     }
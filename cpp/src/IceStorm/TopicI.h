@@ -9,6 +9,7 @@
 #include <IceStorm/Election.h>
 #include <IceStorm/Instrumentation.h>
 #include <IceStorm/Util.h>
+#include <IceStorm/Instance.h>
 #include <Ice/ObserverHelper.h>
 #include <list>
 
@@ -19,7 +20,7 @@ namespace IceStorm
 class PersistentInstance;
 class Subscriber;
 
-class TopicImpl
+class TopicImpl : public std::enable_shared_from_this<TopicImpl>
 {
 public:
 
@@ -50,7 +51,7 @@ public:
     Ice::Identity id() const;
     TopicPrxPtr proxy() const;
     void shutdown();
-    void publish(bool, const EventDataSeq&);
+    void publish(bool, EventDataSeq);
 
     // Observer methods.
     void observerAddSubscriber(const IceStormElection::LogUpdate&, const SubscriberRecord&);
@@ -68,6 +69,7 @@ private:
 
     IceStormElection::LogUpdate destroyInternal(const IceStormElection::LogUpdate&, bool);
     void removeSubscribers(const Ice::IdentitySeq&);
+    void reapSubscribers(const Ice::IdentitySeq&);
 
     //
     // Immutable members.
@@ -96,6 +98,20 @@ private:
     //
     std::vector<std::shared_ptr<Subscriber>> _subscribers;
 
+    //
+    // An immutable copy of the subscribers and observer, replaced each time they're
+    // updated. Publishers load it atomically instead of locking _subscribersMutex and
+    // copying the subscribers for each event. The subscribers are partitioned in the
+    // shards of the instance publish shards, or in a single shard if there are none.
+    //
+    struct PublishState
+    {
+        SubscriberShards shards;
+        std::shared_ptr<IceStorm::Instrumentation::TopicObserver> observer;
+    };
+    void updatePublishState(); // Must be called with _subscribersMutex locked.
+    std::shared_ptr<const PublishState> _publishState;
+
     bool _destroyed; // Has this Topic been destroyed?
 
     LLUMap _lluMap;
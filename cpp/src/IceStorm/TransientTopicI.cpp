@@ -43,7 +43,7 @@ public:
 
         EventDataSeq v;
         v.push_back(std::move(event));
-        _impl->publish(false, v);
+        _impl->publish(false, std::move(v));
 
         return true;
     }
@@ -125,6 +125,7 @@ TransientTopicImpl::TransientTopicImpl(shared_ptr<Instance> instance,
     _instance(std::move(instance)),
     _name(name),
     _id(id),
+    _publishSubscribers(make_shared<const SubscriberShards>(_instance->partitionSubscribers({}))),
     _destroyed(false)
 {
 }
@@ -203,6 +204,7 @@ TransientTopicImpl::subscribeAndGetPublisher(QoS qos, Ice::ObjectPrxPtr obj, con
 
     auto subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    updatePublishSubscribers();
 
     return subscriber->proxy();
 }
@@ -243,6 +245,7 @@ TransientTopicImpl::unsubscribe(Ice::ObjectPrxPtr subscriber, const Ice::Current
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        updatePublishSubscribers();
     }
 }
 
@@ -286,6 +289,7 @@ TransientTopicImpl::link(TopicPrxPtr topic, int cost, const Ice::Current&)
 
     auto subscriber = Subscriber::create(_instance, record);
     _subscribers.push_back(subscriber);
+    updatePublishSubscribers();
 }
 
 void
@@ -327,6 +331,7 @@ TransientTopicImpl::unlink(TopicPrxPtr topic, const Ice::Current&)
     {
         (*p)->destroy();
         _subscribers.erase(p);
+        updatePublishSubscribers();
     }
 }
 
@@ -398,6 +403,7 @@ TransientTopicImpl::destroy(const Ice::Current&)
         subscriber->destroy();
     }
     _subscribers.clear();
+    updatePublishSubscribers();
 }
 
 void
@@ -420,65 +426,96 @@ TransientTopicImpl::id() const
 }
 
 void
-TransientTopicImpl::publish(bool forwarded, const EventDataSeq& events)
+TransientTopicImpl::updatePublishSubscribers()
 {
+    atomic_store(&_publishSubscribers, make_shared<const SubscriberShards>(_instance->partitionSubscribers(_subscribers)));
+}
+
+void
+TransientTopicImpl::publish(bool forwarded, EventDataSeq v)
+{
+    //
+    // The events are shared by the queues of all the subscribers.
+    //
+    auto events = make_shared<const EventDataPtrSeq>(shareEvents(std::move(v)));
+
     //
-    // Copy of the subscriber list so that event publishing can occur
-    // in parallel.
+    // Load the subscribers without locking so that event publishing can occur
+    // in parallel and doesn't contend with subscriber updates.
     //
-    vector<shared_ptr<Subscriber>> copy;
+    auto shards = atomic_load(&_publishSubscribers);
+
+    //
+    // With publish shards, the events are queued to each shard of subscribers
+    // by the shard thread which also reaps the subscribers in error.
+    //
+    auto publishShards = _instance->publishShards();
+    if(publishShards)
     {
-        lock_guard<mutex> lg(_mutex);
-        copy = _subscribers;
+        auto self = shared_from_this();
+        for(size_t i = 0; i < shards->size(); ++i)
+        {
+            if(!(*shards)[i].empty())
+            {
+                publishShards->dispatch(i, [self, shards, events, forwarded, i]
+                {
+                    Ice::IdentitySeq ids = queueEvents(forwarded, *events, (*shards)[i]);
+                    if(!ids.empty())
+                    {
+                        self->reapSubscribers(ids);
+                    }
+                });
+            }
+        }
+        return;
     }
 
     //
     // Queue each event, gathering a list of those subscribers that
     // must be reaped.
     //
-    vector<Ice::Identity> ids;
-    for(const auto& subscriber : copy)
+    Ice::IdentitySeq ids = queueEvents(forwarded, *events, (*shards)[0]);
+    if(!ids.empty())
     {
-        if(!subscriber->queue(forwarded, events) && subscriber->reap())
-        {
-            ids.push_back(subscriber->id());
-        }
+        reapSubscribers(ids);
     }
+}
 
+void
+TransientTopicImpl::reapSubscribers(const Ice::IdentitySeq& ids)
+{
     //
     // Run through the error list removing those subscribers that are
     // in error from the subscriber list.
     //
-    if(!ids.empty())
+    lock_guard<mutex> lg(_mutex);
+    for(const auto& id : ids)
     {
-        lock_guard<mutex> lg(_mutex);
-        for(const auto& id : ids)
+        //
+        // Its possible for the subscriber to already have been
+        // removed since the snapshot is iterated over outside of
+        // mutex protection.
+        //
+        // Note that although this could be quicker if we used a
+        // map, the most optimal case should be pushing around
+        // events not searching for a particular subscriber.
+        //
+        // The subscriber is immediately destroyed & removed from
+        // the _subscribers list. Add the subscriber to a list of
+        // error'd subscribers and remove it from the database on
+        // the next reap.
+        //
+        auto q = find(_subscribers.begin(), _subscribers.end(), id);
+        if(q != _subscribers.end())
         {
             //
-            // Its possible for the subscriber to already have been
-            // removed since the copy is iterated over outside of
-            // mutex protection.
-            //
-            // Note that although this could be quicker if we used a
-            // map, the most optimal case should be pushing around
-            // events not searching for a particular subscriber.
+            // Destroy the subscriber.
             //
-            // The subscriber is immediately destroyed & removed from
-            // the _subscribers list. Add the subscriber to a list of
-            // error'd subscribers and remove it from the database on
-            // the next reap.
-            //
-            auto q = find(_subscribers.begin(), _subscribers.end(), id);
-            if(q != _subscribers.end())
-            {
-                //
-                // Destroy the subscriber.
-                //
-                (*q)->destroy();
-                _subscribers.erase(q);
-            }
+            (*q)->destroy();
+            _subscribers.erase(q);
         }
     }
+    updatePublishSubscribers();
 }
 
 void
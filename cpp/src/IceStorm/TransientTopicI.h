@@ -6,15 +6,15 @@
 #define TRANSIENT_TOPIC_I_H
 
 #include <IceStorm/IceStormInternal.h>
+#include <IceStorm/Instance.h>
 
 namespace IceStorm
 {
 
 // Forward declarations.
-class Instance;
 class Subscriber;
 
-class TransientTopicImpl : public TopicInternal
+class TransientTopicImpl : public TopicInternal, public std::enable_shared_from_this<TransientTopicImpl>
 {
 public:
 
@@ -37,7 +37,7 @@ public:
     // Internal methods
     bool destroyed() const;
     Ice::Identity id() const;
-    void publish(bool, const EventDataSeq&);
+    void publish(bool, EventDataSeq);
 
     void shutdown();
 
@@ -45,6 +45,8 @@ private:
 
     TransientTopicImpl(std::shared_ptr<Instance>, const std::string&, const Ice::Identity&);
 
+    void reapSubscribers(const Ice::IdentitySeq&);
+
     //
     // Immutable members.
     //
@@ -64,6 +66,15 @@ private:
     //
     std::vector<std::shared_ptr<Subscriber>> _subscribers;
 
+    //
+    // An immutable copy of the subscribers, replaced each time they're updated.
+    // Publishers load it atomically instead of locking _mutex and copying the
+    // subscribers for each event. The subscribers are partitioned in the shards
+    // of the instance publish shards, or in a single shard if there are none.
+    //
+    void updatePublishSubscribers(); // Must be called with _mutex locked.
+    std::shared_ptr<const SubscriberShards> _publishSubscribers;
+
     bool _destroyed; // Has this Topic been destroyed?
 
     mutable std::mutex _mutex;
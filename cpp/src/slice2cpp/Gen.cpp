@@ -245,6 +245,66 @@ throwUserExceptionLambda(IceUtilInternal::Output& C, ExceptionList throws, const
     }
 }
 
+//
+// Writes a switch on the characters of the given operation names, which all have the same
+// length, until each case holds a single name. The operation is compared once with this name.
+//
+void
+writeDispatchSwitch(Output& C, const vector<string>& names)
+{
+    if(names.size() == 1)
+    {
+        C << nl << "if(current.operation == \"" << names.front() << "\")";
+        C << sb;
+        C << nl << "return _iceD_" << names.front() << "(in, current);";
+        C << eb;
+        C << nl << "break;";
+        return;
+    }
+
+    //
+    // Switch on the character which discriminates the most names.
+    //
+    size_t index = 0;
+    size_t count = 0;
+    for(size_t i = 0; i < names.front().size(); ++i)
+    {
+        set<char> chars;
+        for(const auto& name : names)
+        {
+            chars.insert(name[i]);
+        }
+        if(chars.size() > count)
+        {
+            index = i;
+            count = chars.size();
+        }
+    }
+    assert(count > 1);
+
+    map<char, vector<string>> cases;
+    for(const auto& name : names)
+    {
+        cases[name[index]].push_back(name);
+    }
+
+    C << nl << "switch(current.operation[" << index << "])";
+    C << sb;
+    for(const auto& q : cases)
+    {
+        C << nl << "case '" << q.first << "':";
+        C << sb;
+        writeDispatchSwitch(C, q.second);
+        C << eb;
+    }
+    C << nl << "default:";
+    C << sb;
+    C << nl << "break;";
+    C << eb;
+    C << eb;
+    C << nl << "break;";
+}
+
 string
 marshaledResultStructName(const string& name)
 {
@@ -2977,43 +3037,32 @@ Slice::Gen::InterfaceVisitor::visitInterfaceDefEnd(const InterfaceDefPtr& p)
           << getUnqualified("::Ice::Current&", scope) << " current)";
         C << sb;
 
-        C << sp;
-        C << nl << "static constexpr ::std::string_view allOperations[] = ";
-        C.spar("{ ");
-        for (const auto& opName : allOpNames)
+        //
+        // Switch on the operation length and then on the characters which discriminate the
+        // operation names, so that the operation is compared with at most one name.
+        //
+        map<size_t, vector<string>> opNamesByLength;
+        for(const auto& opName : allOpNames)
         {
-            C << '"' + opName + '"';
+            opNamesByLength[opName.size()].push_back(opName);
         }
-        C.epar(" }");
-        C << ";";
 
-        C << sp;
-        C << nl << "::std::pair<const ::std::string_view*, const ::std::string_view*> r = "
-          << "::std::equal_range(allOperations, allOperations" << " + " << allOpNames.size()
-          << ", current.operation);";
-        C << nl << "if(r.first == r.second)";
+        C << nl << "switch(current.operation.size())";
         C << sb;
-        C << nl << "throw " << getUnqualified("::Ice::OperationNotExistException", scope)
-          << "(__FILE__, __LINE__, current.id, current.facet, current.operation);";
-        C << eb;
-        C << sp;
-        C << nl << "switch(r.first - allOperations)";
-        C << sb;
-        int i = 0;
-        for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
+        for(const auto& q : opNamesByLength)
         {
-            C << nl << "case " << i++ << ':';
+            C << nl << "case " << q.first << ':';
             C << sb;
-            C << nl << "return _iceD_" << *q << "(in, current);";
+            writeDispatchSwitch(C, q.second);
             C << eb;
         }
         C << nl << "default:";
         C << sb;
-        C << nl << "assert(false);";
-        C << nl << "throw " << getUnqualified("::Ice::OperationNotExistException", scope)
-          << "(__FILE__, __LINE__, current.id, current.facet, current.operation);";
+        C << nl << "break;";
         C << eb;
         C << eb;
+        C << nl << "throw " << getUnqualified("::Ice::OperationNotExistException", scope)
+          << "(__FILE__, __LINE__, current.id, current.facet, current.operation);";
         C << eb;
         C << nl << "/// \\endcond";
     }
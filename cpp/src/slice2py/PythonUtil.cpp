@@ -3178,11 +3178,12 @@ Slice::Python::MetaDataVisitor::validateSequence(const string& file, const strin
                     {
                         continue;
                     }
-                    else if(arg == "array.array" || arg == "numpy.ndarray" || arg.find("memoryview:") == 0)
+                    else if(arg == "array.array" || arg == "numpy.ndarray" || arg.find("memoryview:") == 0 ||
+                            arg == "nocopy")
                     {
                         //
-                        // The memoryview sequence metadata is only valid for integral builtin
-                        // types excluding strings.
+                        // The memoryview and nocopy sequence metadata are only valid for integral
+                        // builtin types excluding strings.
                         //
                         BuiltinPtr builtin = dynamic_pointer_cast<Builtin>(seq->type());
                         if(builtin)
@@ -8,6 +8,7 @@
 #include <CallbackI.h>
 #include <thread>
 #include <chrono>
+#include <atomic>
 
 using namespace std;
 using namespace std::chrono_literals;
@@ -178,6 +179,55 @@ CallbackClient::run(int argc, char** argv)
         cout << "ok" << endl;
     }
 
+    {
+        cout << "testing idle session latency... " << flush;
+
+        //
+        // While the first session keeps the request queue thread busy, the requests of an
+        // idle session are forwarded immediately: they don't wait for the sleep time that
+        // batches the requests of the busy session.
+        //
+        Ice::InitializationData initData;
+        initData.properties = properties->clone();
+        Ice::CommunicatorHolder idleCommunicator(initData);
+        auto idleRouter = uncheckedCast<Glacier2::RouterPrx>(
+            idleCommunicator->stringToProxy("Glacier2/router:" + getTestEndpoint(50)));
+        idleCommunicator->setDefaultRouter(idleRouter);
+        idleRouter->createSession("userid2", "abc123");
+        auto idle = uncheckedCast<CallbackPrx>(idleCommunicator->stringToProxy("c/callback:" + getTestEndpoint()));
+        idle->ice_ping();
+
+        atomic<bool> done(false);
+        thread busy([&]()
+        {
+            while(!done)
+            {
+                oneway->ice_ping();
+                this_thread::sleep_for(5ms);
+            }
+        });
+
+        chrono::steady_clock::duration total(0);
+        for(int i = 0; i < 20; ++i)
+        {
+            this_thread::sleep_for(100ms);
+            auto start = chrono::steady_clock::now();
+            idle->ice_ping();
+            total += chrono::steady_clock::now() - start;
+        }
+        done = true;
+        busy.join();
+
+        //
+        // If the idle session waited for the sleep time of the busy session, the pings
+        // would take 25ms on average.
+        //
+        test(total < 250ms);
+
+        idleRouter->destroySession();
+        cout << "ok" << endl;
+    }
+
     {
         cout << "shutdown... " << flush;
         twoway->shutdown();
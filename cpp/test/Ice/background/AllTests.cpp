@@ -287,6 +287,88 @@ allTests(Test::TestHelper* helper)
         cout << "ok" << endl;
     }
 
+    if(!ws && !wss)
+    {
+        cout << "testing partial gathered writes... " << flush;
+
+        Ice::ByteSeq seq;
+        for(int size : { 1, 7, 14, 100, 1000 })
+        {
+            configuration->writeSize(size);
+            backgroundController->writeSize(size);
+
+            //
+            // Requests queued while the connection isn't writable are gathered with the
+            // request being sent, writes of size bytes end within the requests and on the
+            // request boundaries.
+            //
+            vector<future<void>> sent;
+            vector<future<void>> results;
+            configuration->writeReady(false);
+            for(int i = 0; i < 100; ++i)
+            {
+                seq.resize(static_cast<size_t>(i * 10));
+                auto s = make_shared<promise<void>>();
+                auto r = make_shared<promise<void>>();
+                sent.push_back(s->get_future());
+                results.push_back(r->get_future());
+                background->opWithPayloadAsync(seq,
+                                               [r]() { r->set_value(); },
+                                               [r](exception_ptr e) { r->set_exception(e); },
+                                               [s](bool) { s->set_value(); });
+                results.push_back(background->ice_oneway()->opAsync());
+            }
+
+            for(auto& f : sent)
+            {
+                f.get();
+            }
+            for(auto& f : results)
+            {
+                f.get();
+            }
+        }
+
+        configuration->writeSize(0);
+        backgroundController->writeSize(0);
+        cout << "ok" << endl;
+    }
+
+    if(!ws && !wss)
+    {
+        cout << "testing read-ahead... " << flush;
+
+        configuration->buffered(false);
+        backgroundController->buffered(false);
+        background->ice_getConnection()->close(Ice::ConnectionClose::GracefullyWithWait);
+
+        Ice::ByteSeq seq;
+        for(int size : { 7, 14, 100, 1000, 0 })
+        {
+            configuration->readSize(size);
+            backgroundController->readSize(size);
+
+            //
+            // Reads of size bytes end within messages or contain the end of a message and
+            // the start of the next ones. The large requests are also sent with partial
+            // gathered writes and their body is read without the read-ahead buffer.
+            //
+            vector<future<void>> results;
+            for(int i = 0; i < 100; ++i)
+            {
+                seq.resize(static_cast<size_t>(i % 50 == 0 ? 512 * 1024 : i * 10));
+                results.push_back(background->opWithPayloadAsync(seq));
+                results.push_back(background->ice_oneway()->opAsync());
+            }
+
+            for(auto& f : results)
+            {
+                f.get();
+            }
+        }
+        cout << "ok" << endl;
+    }
+
     return background;
 }
 
@@ -19,7 +19,9 @@ Configuration::Configuration() :
     _initializeResetCount(0),
     _readReadyCount(0),
     _writeReadyCount(0),
-    _buffered(false)
+    _buffered(false),
+    _writeSize(0),
+    _readSize(0)
 {
     assert(!_instance);
 }
@@ -197,6 +199,34 @@ Configuration::buffered()
     return _buffered;
 }
 
+void
+Configuration::writeSize(int size)
+{
+    lock_guard lock(_mutex);
+    _writeSize = size;
+}
+
+int
+Configuration::writeSize()
+{
+    lock_guard lock(_mutex);
+    return _writeSize;
+}
+
+void
+Configuration::readSize(int size)
+{
+    lock_guard lock(_mutex);
+    _readSize = size;
+}
+
+int
+Configuration::readSize()
+{
+    lock_guard lock(_mutex);
+    return _readSize;
+}
+
 ConfigurationPtr
 Configuration::getInstance()
 {
@@ -56,6 +56,12 @@ public:
     void buffered(bool);
     bool buffered();
 
+    void writeSize(int);
+    int writeSize();
+
+    void readSize(int);
+    int readSize();
+
     static ConfigurationPtr getInstance();
 
 private:
@@ -70,6 +76,8 @@ private:
     int _writeReadyCount;
     std::unique_ptr<Ice::LocalException> _writeException;
     bool _buffered;
+    int _writeSize;
+    int _readSize;
     std::mutex _mutex;
     static ConfigurationPtr _instance;
 };
@@ -107,6 +107,18 @@ BackgroundControllerI::buffered(bool enable, const Ice::Current&)
     _configuration->buffered(enable);
 }
 
+void
+BackgroundControllerI::writeSize(int size, const Ice::Current&)
+{
+    _configuration->writeSize(size);
+}
+
+void
+BackgroundControllerI::readSize(int size, const Ice::Current&)
+{
+    _configuration->readSize(size);
+}
+
 BackgroundControllerI::BackgroundControllerI(const Ice::ObjectAdapterPtr& adapter,
                                              const ConfigurationPtr& configuration) :
     _adapter(adapter),
@@ -49,6 +49,8 @@ public:
     virtual void writeException(bool, const Ice::Current&);
 
     virtual void buffered(bool, const Ice::Current&);
+    virtual void writeSize(int, const Ice::Current&);
+    virtual void readSize(int, const Ice::Current&);
 
     BackgroundControllerI(const Ice::ObjectAdapterPtr&, const ConfigurationPtr&);
 
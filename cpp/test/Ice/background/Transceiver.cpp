@@ -8,6 +8,8 @@
 
 #include <Transceiver.h>
 
+#include <deque>
+
 using namespace std;
 
 IceInternal::NativeInfoPtr
@@ -75,9 +77,90 @@ Transceiver::write(IceInternal::Buffer& buf)
     }
 
     _configuration->checkWriteException();
+    size_t writeSize = static_cast<size_t>(_configuration->writeSize());
+    if(writeSize > 0)
+    {
+        return writeLimited(vector<IceInternal::Buffer*>(1, &buf), writeSize);
+    }
     return _transceiver->write(buf);
 }
 
+IceInternal::SocketOperation
+Transceiver::writev(const vector<IceInternal::Buffer*>& bufs)
+{
+    bool pending = false;
+    for(vector<IceInternal::Buffer*>::const_iterator p = bufs.begin(); p != bufs.end(); ++p)
+    {
+        pending = pending || (*p)->i < (*p)->b.end();
+    }
+    if(!_configuration->writeReady() && pending)
+    {
+        return IceInternal::SocketOperationWrite;
+    }
+
+    _configuration->checkWriteException();
+    size_t writeSize = static_cast<size_t>(_configuration->writeSize());
+    if(writeSize > 0)
+    {
+        return writeLimited(bufs, writeSize);
+    }
+    return _transceiver->writev(bufs);
+}
+
+IceInternal::SocketOperation
+Transceiver::writeLimited(const vector<IceInternal::Buffer*>& bufs, size_t size)
+{
+    //
+    // Only give the first size bytes of the buffers to the transceiver, the
+    // write completes in the middle of a buffer or on a buffer boundary.
+    //
+    deque<IceInternal::Buffer> limited;
+    vector<IceInternal::Buffer*> sources;
+    for(vector<IceInternal::Buffer*>::const_iterator p = bufs.begin(); p != bufs.end() && size > 0; ++p)
+    {
+        size_t length = min(static_cast<size_t>((*p)->b.end() - (*p)->i), size);
+        if(length > 0)
+        {
+            limited.emplace_back((*p)->i, (*p)->i + length);
+            sources.push_back(*p);
+            size -= length;
+        }
+    }
+    if(limited.empty())
+    {
+        return IceInternal::SocketOperationNone;
+    }
+
+    vector<IceInternal::Buffer*> limitedBufs;
+    for(deque<IceInternal::Buffer>::iterator p = limited.begin(); p != limited.end(); ++p)
+    {
+        limitedBufs.push_back(&*p);
+    }
+    IceInternal::SocketOperation op = limitedBufs.size() == 1 ?
+        _transceiver->write(*limitedBufs.front()) : _transceiver->writev(limitedBufs);
+    for(size_t i = 0; i < limited.size(); ++i)
+    {
+        sources[i]->i += limited[i].i - limited[i].b.begin();
+    }
+    if(op != IceInternal::SocketOperationNone)
+    {
+        return op;
+    }
+
+    //
+    // The transceiver is still writable if bytes are left, wait for the
+    // selector to report it.
+    //
+    for(vector<IceInternal::Buffer*>::const_iterator p = bufs.begin(); p != bufs.end(); ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            return IceInternal::SocketOperationWrite;
+        }
+    }
+    return IceInternal::SocketOperationNone;
+}
+
 IceInternal::SocketOperation
 Transceiver::read(IceInternal::Buffer& buf)
 {
@@ -123,6 +206,18 @@ Transceiver::read(IceInternal::Buffer& buf)
     }
     else
     {
+        size_t readSize = static_cast<size_t>(_configuration->readSize());
+        if(readSize > 0 && static_cast<size_t>(buf.b.end() - buf.i) > readSize)
+        {
+            //
+            // Only read size bytes, the data received might end in the middle of a
+            // message or contain the end of a message and the start of the next.
+            //
+            IceInternal::Buffer limited(buf.i, buf.i + readSize);
+            IceInternal::SocketOperation op = _transceiver->read(limited);
+            buf.i += limited.i - limited.b.begin();
+            return op != IceInternal::SocketOperationNone ? op : IceInternal::SocketOperationRead;
+        }
         return _transceiver->read(buf);
     }
 }
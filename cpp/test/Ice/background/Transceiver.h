@@ -19,6 +19,7 @@ public:
     IceInternal::SocketOperation closing(bool, std::exception_ptr) final;
     void close();
     IceInternal::SocketOperation write(IceInternal::Buffer&) final;
+    IceInternal::SocketOperation writev(const std::vector<IceInternal::Buffer*>&) final;
     IceInternal::SocketOperation read(IceInternal::Buffer&) final;
 #ifdef ICE_USE_IOCP
     bool startWrite(IceInternal::Buffer&) final;
@@ -38,6 +39,8 @@ public:
 
 private:
 
+    IceInternal::SocketOperation writeLimited(const std::vector<IceInternal::Buffer*>&, size_t);
+
     friend class Connector;
     friend class Acceptor;
     friend class EndpointI;
@@ -0,0 +1,483 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestHelper.h>
+#include <Test.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+//
+// The benchmarks are configured with the following properties:
+//
+// Benchmark.Iterations: the number of invocations of each benchmark (default 1000). The
+//   default keeps the benchmarks short when they run with the test suite, measurements
+//   should use a larger value.
+// Benchmark.Threads: the number of client threads of the thread pool scaling benchmark
+//   (default "1 2 4").
+// Benchmark.Output: the file the JSON results are written to, the results aren't written
+//   if not set.
+//
+
+namespace
+{
+
+typedef chrono::high_resolution_clock Clock;
+
+class Results
+{
+public:
+
+    Results(const string& transport, bool collocated, int iterations) :
+        _transport(transport),
+        _collocated(collocated),
+        _iterations(iterations)
+    {
+    }
+
+    void
+    setProperties(const string& name, const PropertyDict& properties)
+    {
+        _properties.push_back(make_pair(name, properties));
+    }
+
+    //
+    // Add a latency benchmark result, the samples are the durations of each
+    // invocation in microseconds.
+    //
+    void
+    addLatency(const string& name, vector<double>& samples, size_t bytes = 0)
+    {
+        assert(!samples.empty());
+        sort(samples.begin(), samples.end());
+
+        double total = 0;
+        for(vector<double>::const_iterator p = samples.begin(); p != samples.end(); ++p)
+        {
+            total += *p;
+        }
+
+        ostringstream os;
+        os << "{\"name\": " << quote(name) << ", \"count\": " << samples.size() << ", \"unit\": \"us\""
+           << ", \"mean\": " << total / static_cast<double>(samples.size())
+           << ", \"min\": " << samples.front()
+           << ", \"p50\": " << percentile(samples, 0.5)
+           << ", \"p90\": " << percentile(samples, 0.9)
+           << ", \"p99\": " << percentile(samples, 0.99)
+           << ", \"p999\": " << percentile(samples, 0.999)
+           << ", \"max\": " << samples.back()
+           << ", \"throughput\": " << rate(static_cast<double>(samples.size()) * 1000000.0, total);
+        if(bytes > 0)
+        {
+            os << ", \"bandwidth\": " << rate(static_cast<double>(samples.size() * bytes), total); // MB/s
+        }
+        os << "}";
+        _benchmarks.push_back(os.str());
+    }
+
+    //
+    // Add a throughput benchmark result, count operations completed in the given time.
+    //
+    void
+    addThroughput(const string& name, size_t count, const Clock::duration& duration, int threads = 0)
+    {
+        double seconds = chrono::duration<double>(duration).count();
+
+        ostringstream os;
+        os << "{\"name\": " << quote(name) << ", \"count\": " << count;
+        if(threads > 0)
+        {
+            os << ", \"threads\": " << threads;
+        }
+        os << ", \"duration\": " << seconds << ", \"throughput\": " << rate(static_cast<double>(count), seconds)
+           << "}";
+        _benchmarks.push_back(os.str());
+    }
+
+    void
+    write(ostream& out) const
+    {
+        out << "{\n";
+        out << "    \"transport\": " << quote(_transport) << ",\n";
+        out << "    \"collocated\": " << (_collocated ? "true" : "false") << ",\n";
+        out << "    \"iterations\": " << _iterations << ",\n";
+        out << "    \"properties\": {";
+        for(vector<pair<string, PropertyDict> >::const_iterator p = _properties.begin(); p != _properties.end(); ++p)
+        {
+            out << (p == _properties.begin() ? "\n" : ",\n") << "        " << quote(p->first) << ": {";
+            for(PropertyDict::const_iterator q = p->second.begin(); q != p->second.end(); ++q)
+            {
+                out << (q == p->second.begin() ? "" : ", ") << quote(q->first) << ": " << quote(q->second);
+            }
+            out << "}";
+        }
+        out << "\n    },\n";
+        out << "    \"benchmarks\": [";
+        for(vector<string>::const_iterator p = _benchmarks.begin(); p != _benchmarks.end(); ++p)
+        {
+            out << (p == _benchmarks.begin() ? "\n" : ",\n") << "        " << *p;
+        }
+        out << "\n    ]\n";
+        out << "}" << endl;
+    }
+
+private:
+
+    static double
+    percentile(const vector<double>& samples, double p)
+    {
+        size_t n = static_cast<size_t>(p * static_cast<double>(samples.size()));
+        return samples[min(n, samples.size() - 1)];
+    }
+
+    //
+    // Return the rate as a JSON number, or null if the time is too short to be measured.
+    //
+    static string
+    rate(double count, double time)
+    {
+        if(time <= 0)
+        {
+            return "null";
+        }
+        ostringstream os;
+        os << count / time;
+        return os.str();
+    }
+
+    static string
+    quote(const string& s)
+    {
+        ostringstream os;
+        os << '"';
+        for(string::const_iterator p = s.begin(); p != s.end(); ++p)
+        {
+            if(*p == '"' || *p == '\\')
+            {
+                os << '\\' << *p;
+            }
+            else if(static_cast<unsigned char>(*p) < 0x20)
+            {
+                os << "\\u00" << hex << (*p >> 4 & 0xf) << (*p & 0xf) << dec;
+            }
+            else
+            {
+                os << *p;
+            }
+        }
+        os << '"';
+        return os.str();
+    }
+
+    const string _transport;
+    const bool _collocated;
+    const int _iterations;
+    vector<pair<string, PropertyDict> > _properties;
+    vector<string> _benchmarks;
+};
+
+//
+// Call the given function iterations times and return the duration of each call
+// in microseconds. The function is first called iterations / 10 times to warm up
+// the connection and the caches.
+//
+template<typename F> vector<double>
+measure(int iterations, F f)
+{
+    for(int i = 0; i < iterations / 10; ++i)
+    {
+        f();
+    }
+
+    vector<double> samples;
+    samples.reserve(static_cast<size_t>(iterations));
+    for(int i = 0; i < iterations; ++i)
+    {
+        Clock::time_point start = Clock::now();
+        f();
+        samples.push_back(chrono::duration<double, micro>(Clock::now() - start).count());
+    }
+    return samples;
+}
+
+NodePtr
+createTree(int depth, int& value)
+{
+    if(depth == 0)
+    {
+        return nullptr;
+    }
+    NodePtr node = make_shared<Node>();
+    node->value = value++;
+    node->left = createTree(depth - 1, value);
+    node->right = createTree(depth - 1, value);
+    return node;
+}
+
+}
+
+void
+allTests(Test::TestHelper* helper, bool collocated)
+{
+    CommunicatorPtr communicator = helper->communicator();
+    PropertiesPtr properties = communicator->getProperties();
+
+    const int iterations = max(properties->getPropertyAsIntWithDefault("Benchmark.Iterations", 1000), 10);
+    const string output = properties->getProperty("Benchmark.Output");
+    StringSeq threads;
+    threads.push_back("1");
+    threads.push_back("2");
+    threads.push_back("4");
+    threads = properties->getPropertyAsListWithDefault("Benchmark.Threads", threads);
+
+    Results results(helper->getTestProtocol(), collocated, iterations);
+
+    BenchmarkPrxPtr benchmark =
+        Ice::checkedCast<BenchmarkPrx>(communicator->stringToProxy("benchmark:" + helper->getTestEndpoint()));
+    test(benchmark);
+
+    results.setProperties("client", properties->getPropertiesForPrefix("Ice.ThreadPool."));
+    results.setProperties("server", benchmark->getProperties("Ice.ThreadPool."));
+
+    cout << "benchmarking twoway invocations... " << flush;
+    {
+        vector<double> samples = measure(iterations, [&]() { benchmark->ping(); });
+        results.addLatency("twoway", samples);
+
+        Clock::time_point start = Clock::now();
+        vector<future<void>> futures;
+        futures.reserve(static_cast<size_t>(iterations));
+        for(int i = 0; i < iterations; ++i)
+        {
+            futures.push_back(benchmark->pingAsync());
+        }
+        for(vector<future<void>>::iterator p = futures.begin(); p != futures.end(); ++p)
+        {
+            p->get();
+        }
+        results.addThroughput("twoway.pipelined", futures.size(), Clock::now() - start);
+    }
+    cout << "ok" << endl;
+
+    cout << "benchmarking oneway invocations... " << flush;
+    {
+        BenchmarkPrxPtr oneway = benchmark->ice_oneway();
+        vector<double> samples = measure(iterations, [&]() { oneway->ping(); });
+        benchmark->ping(); // Wait for the oneway requests to be dispatched.
+        results.addLatency("oneway", samples);
+
+        Clock::time_point start = Clock::now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            oneway->ping();
+        }
+        benchmark->ping();
+        results.addThroughput("oneway.burst", static_cast<size_t>(iterations), Clock::now() - start);
+    }
+    cout << "ok" << endl;
+
+    cout << "benchmarking batch oneway invocations... " << flush;
+    {
+        BenchmarkPrxPtr batch = benchmark->ice_batchOneway();
+        Clock::time_point start = Clock::now();
+        for(int i = 0; i < iterations; ++i)
+        {
+            batch->ping();
+            if(i % 100 == 99)
+            {
+                batch->ice_flushBatchRequests();
+            }
+        }
+        batch->ice_flushBatchRequests();
+        benchmark->ping();
+        results.addThroughput("batch", static_cast<size_t>(iterations), Clock::now() - start);
+    }
+    cout << "ok" << endl;
+
+    cout << "benchmarking byte sequences... " << flush;
+    {
+        const int sizes[] = { 1024, 64 * 1024, 1024 * 1024 };
+        for(size_t i = 0; i < sizeof(sizes) / sizeof(int); ++i)
+        {
+            //
+            // Fewer iterations for the large sequences to keep the run time similar.
+            //
+            int size = sizes[i];
+            int count = max(iterations * 1024 / size, 10);
+            ostringstream name;
+            name << size / 1024 << "KB";
+
+            ByteSeq seq(static_cast<size_t>(size));
+            pair<const Byte*, const Byte*> inSeq(seq.data(), seq.data() + seq.size());
+            vector<double> samples = measure(count, [&]() { benchmark->sendByteSeq(inSeq); });
+            results.addLatency("sendByteSeq." + name.str(), samples, seq.size());
+
+            samples = measure(count, [&]() { test(benchmark->recvByteSeq(size).size() == seq.size()); });
+            results.addLatency("recvByteSeq." + name.str(), samples, seq.size());
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "benchmarking structs and classes... " << flush;
+    {
+        FixedSeq fixedSeq(1000);
+        VariableSeq variableSeq(1000);
+        for(int i = 0; i < 1000; ++i)
+        {
+            fixedSeq[static_cast<size_t>(i)].i = i;
+            fixedSeq[static_cast<size_t>(i)].d = i;
+            variableSeq[static_cast<size_t>(i)].s = "hello world";
+            variableSeq[static_cast<size_t>(i)].i = i;
+        }
+        int value = 0;
+        NodePtr tree = createTree(8, value); // 255 nodes
+
+        vector<double> samples = measure(iterations, [&]() { benchmark->echoFixedSeq(fixedSeq); });
+        results.addLatency("echoFixedSeq.1000", samples);
+
+        samples = measure(iterations, [&]() { benchmark->echoVariableSeq(variableSeq); });
+        results.addLatency("echoVariableSeq.1000", samples);
+
+        samples = measure(iterations, [&]() { benchmark->echoNode(tree); });
+        results.addLatency("echoNode.255", samples);
+    }
+    cout << "ok" << endl;
+
+    cout << "benchmarking marshaling... " << flush;
+    {
+        FixedSeq fixedSeq(1000);
+        VariableSeq variableSeq(1000);
+        for(int i = 0; i < 1000; ++i)
+        {
+            fixedSeq[static_cast<size_t>(i)].i = i;
+            variableSeq[static_cast<size_t>(i)].s = "hello world";
+        }
+        int value = 0;
+        NodePtr tree = createTree(8, value);
+
+        vector<double> samples = measure(iterations, [&]()
+            {
+                OutputStream out(communicator);
+                out.write(fixedSeq);
+                out.finished();
+            });
+        results.addLatency("marshal.FixedSeq.1000", samples);
+
+        samples = measure(iterations, [&]()
+            {
+                OutputStream out(communicator);
+                out.write(variableSeq);
+                out.finished();
+            });
+        results.addLatency("marshal.VariableSeq.1000", samples);
+
+        samples = measure(iterations, [&]()
+            {
+                OutputStream out(communicator);
+                out.write(tree);
+                out.writePendingValues();
+                out.finished();
+            });
+        results.addLatency("marshal.Node.255", samples);
+
+        vector<Byte> data;
+        {
+            OutputStream out(communicator);
+            out.write(fixedSeq);
+            out.finished(data);
+        }
+        samples = measure(iterations, [&]()
+            {
+                InputStream in(communicator, data);
+                FixedSeq seq;
+                in.read(seq);
+            });
+        results.addLatency("unmarshal.FixedSeq.1000", samples);
+
+        {
+            OutputStream out(communicator);
+            out.write(variableSeq);
+            out.finished(data);
+        }
+        samples = measure(iterations, [&]()
+            {
+                InputStream in(communicator, data);
+                VariableSeq seq;
+                in.read(seq);
+            });
+        results.addLatency("unmarshal.VariableSeq.1000", samples);
+
+        {
+            OutputStream out(communicator);
+            out.write(tree);
+            out.writePendingValues();
+            out.finished(data);
+        }
+        samples = measure(iterations, [&]()
+            {
+                InputStream in(communicator, data);
+                NodePtr node;
+                in.read(node);
+                in.readPendingValues();
+                test(node && node->value == 0);
+            });
+        results.addLatency("unmarshal.Node.255", samples);
+    }
+    cout << "ok" << endl;
+
+    cout << "benchmarking thread pool scaling... " << flush;
+    {
+        for(StringSeq::const_iterator p = threads.begin(); p != threads.end(); ++p)
+        {
+            int count = atoi(p->c_str());
+            if(count < 1)
+            {
+                continue;
+            }
+
+            vector<thread> workers;
+            Clock::time_point start = Clock::now();
+            for(int i = 0; i < count; ++i)
+            {
+                workers.push_back(thread([&]()
+                    {
+                        for(int j = 0; j < iterations; ++j)
+                        {
+                            benchmark->ping();
+                        }
+                    }));
+            }
+            for(vector<thread>::iterator q = workers.begin(); q != workers.end(); ++q)
+            {
+                q->join();
+            }
+            results.addThroughput("twoway.threads", static_cast<size_t>(count * iterations), Clock::now() - start,
+                                  count);
+        }
+    }
+    cout << "ok" << endl;
+
+    if(!output.empty())
+    {
+        ofstream out(output.c_str());
+        if(!out)
+        {
+            cerr << "cannot open `" << output << "' for writing" << endl;
+            test(false);
+        }
+        results.write(out);
+    }
+
+    if(!collocated)
+    {
+        benchmark->shutdown();
+    }
+}
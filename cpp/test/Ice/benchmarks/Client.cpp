@@ -0,0 +1,32 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestHelper.h>
+#include <Test.h>
+
+using namespace std;
+
+class Client : public Test::TestHelper
+{
+public:
+
+    void run(int, char**);
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    Ice::StringSeq args = Ice::argsToStringSeq(argc, argv);
+    args = properties->parseCommandLineOptions("Benchmark", args);
+    Ice::stringSeqToArgs(args, argc, argv);
+    properties->setProperty("Ice.MessageSizeMax", "0");
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+
+    void allTests(Test::TestHelper*, bool);
+    allTests(this, false);
+}
+
+DEFINE_TEST(Client)
@@ -0,0 +1,36 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestHelper.h>
+#include <TestI.h>
+
+using namespace std;
+
+class Collocated : public Test::TestHelper
+{
+public:
+
+    void run(int, char**);
+};
+
+void
+Collocated::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    Ice::StringSeq args = Ice::argsToStringSeq(argc, argv);
+    args = properties->parseCommandLineOptions("Benchmark", args);
+    Ice::stringSeqToArgs(args, argc, argv);
+    properties->setProperty("Ice.MessageSizeMax", "0");
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(std::make_shared<BenchmarkI>(), Ice::stringToIdentity("benchmark"));
+    //adapter->activate(); // Don't activate OA to ensure collocation is used.
+
+    void allTests(Test::TestHelper*, bool);
+    allTests(this, true);
+}
+
+DEFINE_TEST(Collocated)
@@ -0,0 +1,55 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+using namespace Ice;
+
+void
+BenchmarkI::ping(const Current&)
+{
+}
+
+void
+BenchmarkI::sendByteSeq(pair<const Byte*, const Byte*>, const Current&)
+{
+}
+
+ByteSeq
+BenchmarkI::recvByteSeq(int size, const Current&)
+{
+    return ByteSeq(static_cast<size_t>(size));
+}
+
+Test::FixedSeq
+BenchmarkI::echoFixedSeq(Test::FixedSeq seq, const Current&)
+{
+    return seq;
+}
+
+Test::VariableSeq
+BenchmarkI::echoVariableSeq(Test::VariableSeq seq, const Current&)
+{
+    return seq;
+}
+
+Test::NodePtr
+BenchmarkI::echoNode(Test::NodePtr node, const Current&)
+{
+    return node;
+}
+
+PropertyDict
+BenchmarkI::getProperties(string prefix, const Current& current)
+{
+    return current.adapter->getCommunicator()->getProperties()->getPropertiesForPrefix(prefix);
+}
+
+void
+BenchmarkI::shutdown(const Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,28 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class BenchmarkI : public Test::Benchmark
+{
+public:
+
+    virtual void ping(const Ice::Current&);
+
+    virtual void sendByteSeq(std::pair<const Ice::Byte*, const Ice::Byte*>, const Ice::Current&);
+    virtual Ice::ByteSeq recvByteSeq(int, const Ice::Current&);
+
+    virtual Test::FixedSeq echoFixedSeq(Test::FixedSeq, const Ice::Current&);
+    virtual Test::VariableSeq echoVariableSeq(Test::VariableSeq, const Ice::Current&);
+    virtual Test::NodePtr echoNode(Test::NodePtr, const Ice::Current&);
+
+    virtual Ice::PropertyDict getProperties(std::string, const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
@@ -752,6 +752,83 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing adaptive endpoint selection... " << flush;
+    {
+        vector<RemoteObjectAdapterPrxPtr> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter71", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter72", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter73", "default"));
+
+        TestIntfPrxPtr test = createTestIntfPrx(adapters);
+        test = Ice::uncheckedCast<TestIntfPrx>(test->ice_endpointSelection(Ice::EndpointSelectionType::Adaptive));
+        test(test->ice_getEndpointSelection() == Ice::EndpointSelectionType::Adaptive);
+
+        //
+        // The endpoints without latency samples are used first, so each of the
+        // first invocations uses a different endpoint.
+        //
+        set<string> names;
+        for(int i = 0; i < 3; ++i)
+        {
+            names.insert(test->getAdapterName());
+        }
+        test(names.size() == 3);
+
+        //
+        // The connection is selected for each invocation.
+        //
+        test(!test->ice_getCachedConnection());
+
+        //
+        // The endpoints which can't be connected to aren't used anymore.
+        //
+        com->deactivateObjectAdapter(adapters[0]);
+        com->deactivateObjectAdapter(adapters[1]);
+        for(int i = 0; i < 5; ++i)
+        {
+            test(test->getAdapterName() == "Adapter73");
+        }
+        com->deactivateObjectAdapter(adapters[2]);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection pool... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter81", "default");
+
+        TestIntfPrxPtr test = Ice::uncheckedCast<TestIntfPrx>(adapter->getTestIntf()->ice_connectionPoolSize(3));
+        test(test->ice_getConnectionPoolSize() == 3);
+
+        //
+        // Twoway invocations use the connections of the pool in turn.
+        //
+        vector<Ice::ConnectionPtr> connections;
+        for(int i = 0; i < 3; ++i)
+        {
+            connections.push_back(test->ice_getConnection());
+        }
+        test(connections[0] != connections[1] && connections[1] != connections[2] &&
+             connections[0] != connections[2]);
+        test(test->ice_getConnection() == connections[0]);
+        test(test->ice_getCachedConnection() == connections[0]);
+        for(int i = 0; i < 6; ++i)
+        {
+            test(test->getAdapterName() == "Adapter81");
+        }
+
+        //
+        // Oneway invocations always use the same connection to preserve their ordering.
+        //
+        TestIntfPrxPtr testOneway = Ice::uncheckedCast<TestIntfPrx>(test->ice_oneway());
+        for(int i = 0; i < 3; ++i)
+        {
+            test(testOneway->ice_getConnection() == connections[0]);
+        }
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
     cout << "testing endpoint mode filtering... " << flush;
     {
         vector<RemoteObjectAdapterPrxPtr> adapters;
@@ -0,0 +1,247 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Compression.h>
+#include <Ice/LocalException.h>
+#include <TestHelper.h>
+
+#include <random>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+vector<Byte>
+compress(CompressionCodec& codec, const vector<Byte>& data)
+{
+    vector<Byte> compressed(codec.compressBound(data.size()));
+    compressed.resize(codec.compress(data.data(), data.size(), compressed.data(), compressed.size()));
+    return compressed;
+}
+
+bool
+uncompressFails(CompressionCodec& codec, const vector<Byte>& compressed, size_t size)
+{
+    vector<Byte> uncompressed(size);
+    try
+    {
+        codec.uncompress(compressed.data(), compressed.size(), uncompressed.data(), uncompressed.size());
+        return false;
+    }
+    catch(const CompressionException&)
+    {
+        return true;
+    }
+}
+
+void
+testRoundTrip(CompressionCodec& compressor, CompressionCodec& uncompressor, const vector<Byte>& data)
+{
+    vector<Byte> compressed = compress(compressor, data);
+    vector<Byte> uncompressed(data.size());
+    uncompressor.uncompress(compressed.data(), compressed.size(), uncompressed.data(), uncompressed.size());
+    test(uncompressed == data);
+}
+
+vector<vector<Byte>>
+createMessages()
+{
+    vector<vector<Byte>> messages;
+    mt19937 rng;
+
+    for(size_t sz = 0; sz < 32; ++sz)
+    {
+        messages.push_back(vector<Byte>(sz, 'a'));
+    }
+
+    //
+    // Random data, which doesn't compress.
+    //
+    vector<Byte> random(10000);
+    for(auto& b : random)
+    {
+        b = static_cast<Byte>(rng());
+    }
+    messages.push_back(random);
+
+    //
+    // Text with repetitions, long runs and matches beyond the maximum offset.
+    //
+    string text;
+    for(int i = 0; i < 5000; ++i)
+    {
+        text += "message " + to_string(i % 97) + " ";
+        if(i % 1000 == 0)
+        {
+            text += string(1000, 'x');
+        }
+    }
+    messages.push_back(vector<Byte>(text.begin(), text.end()));
+
+    //
+    // Data compressed right after the text, which reuses the positions of the text
+    // kept in the LZ4 hash table.
+    //
+    messages.push_back(vector<Byte>(text.begin(), text.begin() + text.size() / 3));
+
+    vector<Byte> mixed;
+    for(int i = 0; i < 200000; ++i)
+    {
+        mixed.push_back(static_cast<Byte>(i % 7 == 0 ? rng() : i % 13));
+    }
+    messages.push_back(mixed);
+    return messages;
+}
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    virtual void run(int argc, char* argv[]);
+};
+
+void
+Client::run(int, char*[])
+{
+    vector<vector<Byte>> messages = createMessages();
+
+    cout << "testing LZ4 compression... " << flush;
+    {
+        //
+        // The same compressor is used for all the messages, like with a connection.
+        //
+        CompressionCodecPtr compressor = createLZ4Codec();
+        for(const auto& message : messages)
+        {
+            CompressionCodecPtr uncompressor = createLZ4Codec();
+            testRoundTrip(*compressor, *uncompressor, message);
+        }
+        for(auto p = messages.rbegin(); p != messages.rend(); ++p)
+        {
+            testRoundTrip(*compressor, *compressor, *p);
+        }
+
+        string text(10000, 'z');
+        vector<Byte> compressed = compress(*compressor, vector<Byte>(text.begin(), text.end()));
+        test(compressed.size() < 100);
+
+        vector<Byte> data(1000, 'a');
+        vector<Byte> dst(compressor->compressBound(data.size()) - 1);
+        try
+        {
+            compressor->compress(data.data(), data.size(), dst.data(), dst.size());
+            test(false);
+        }
+        catch(const CompressionException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing LZ4 truncated input... " << flush;
+    {
+        CompressionCodecPtr codec = createLZ4Codec();
+        test(uncompressFails(*codec, vector<Byte>(), 0));
+        for(const auto& message : messages)
+        {
+            if(message.size() > 10000)
+            {
+                continue;
+            }
+            vector<Byte> compressed = compress(*codec, message);
+            for(size_t sz = 0; sz < compressed.size(); ++sz)
+            {
+                test(uncompressFails(*codec, vector<Byte>(compressed.begin(), compressed.begin() + sz), message.size()));
+            }
+        }
+
+        //
+        // Literal length extension bytes missing.
+        //
+        test(uncompressFails(*codec, { 0xF0 }, 15));
+        test(uncompressFails(*codec, { 0xF0, 255 }, 270));
+
+        //
+        // Match offset missing.
+        //
+        test(uncompressFails(*codec, { 0x14, 'a', 1 }, 9));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing LZ4 corrupt input... " << flush;
+    {
+        CompressionCodecPtr codec = createLZ4Codec();
+
+        //
+        // One literal followed by a match of 8 bytes with offset 1.
+        //
+        vector<Byte> valid = { 0x14, 'a', 1, 0, 0x00 };
+        vector<Byte> uncompressed(9);
+        codec->uncompress(valid.data(), valid.size(), uncompressed.data(), uncompressed.size());
+        test(uncompressed == vector<Byte>(9, 'a'));
+
+        //
+        // Invalid match offsets.
+        //
+        test(uncompressFails(*codec, { 0x14, 'a', 0, 0, 0x00 }, 9));
+        test(uncompressFails(*codec, { 0x14, 'a', 2, 0, 0x00 }, 9));
+        test(uncompressFails(*codec, { 0x14, 'a', 0xFF, 0xFF, 0x00 }, 9));
+        test(uncompressFails(*codec, { 0x04, 1, 0, 0x00 }, 4));
+
+        //
+        // Literal length larger than the input.
+        //
+        test(uncompressFails(*codec, { 0x30, 'a', 'b' }, 3));
+        test(uncompressFails(*codec, { 0xF0, 10, 'a' }, 25));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing LZ4 size mismatch... " << flush;
+    {
+        CompressionCodecPtr codec = createLZ4Codec();
+        vector<Byte> valid = { 0x14, 'a', 1, 0, 0x00 };
+        test(!uncompressFails(*codec, valid, 9));
+        test(uncompressFails(*codec, valid, 8)); // Match overflows the output
+        test(uncompressFails(*codec, valid, 10)); // Output not filled
+        test(uncompressFails(*codec, valid, 0));
+        test(uncompressFails(*codec, { 0x30, 'a', 'b', 'c' }, 2)); // Literals overflow the output
+        test(uncompressFails(*codec, { 0x30, 'a', 'b', 'c' }, 4));
+
+        for(const auto& message : messages)
+        {
+            vector<Byte> compressed = compress(*codec, message);
+            test(uncompressFails(*codec, compressed, message.size() + 1));
+            if(!message.empty())
+            {
+                test(uncompressFails(*codec, compressed, message.size() - 1));
+            }
+        }
+    }
+    cout << "ok" << endl;
+
+    CompressionCodecPtr bzip2 = createBZip2Codec(1);
+    if(bzip2)
+    {
+        cout << "testing bzip2 compression... " << flush;
+        for(const auto& message : messages)
+        {
+            if(message.empty())
+            {
+                continue;
+            }
+            testRoundTrip(*bzip2, *bzip2, message);
+            vector<Byte> compressed = compress(*bzip2, message);
+            test(uncompressFails(*bzip2, vector<Byte>(compressed.begin(), compressed.end() - 1), message.size()));
+            test(uncompressFails(*bzip2, compressed, message.size() - 1));
+        }
+        cout << "ok" << endl;
+    }
+}
+
+DEFINE_TEST(Client)
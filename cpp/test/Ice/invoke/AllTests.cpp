@@ -79,6 +79,32 @@ allTests(Test::TestHelper* helper)
         {
             test(false);
         }
+
+        // ice_invoke with array mapping and large in-parameters, the request references them
+        const string largeString(256 * 1024, 'A');
+        Ice::OutputStream largeOut(communicator);
+        largeOut.startEncapsulation();
+        largeOut.write(largeString);
+        largeOut.endEncapsulation();
+        inPair = largeOut.finished();
+        for(int i = 0; i < 5; ++i)
+        {
+            if(cl->ice_invoke("opString", Ice::OperationMode::Normal, inPair, outEncaps))
+            {
+                Ice::InputStream in(communicator, out.getEncoding(), outEncaps);
+                in.startEncapsulation();
+                string s;
+                in.read(s);
+                test(s == largeString);
+                in.read(s);
+                test(s == largeString);
+                in.endEncapsulation();
+            }
+            else
+            {
+                test(false);
+            }
+        }
     }
 
     for(int i = 0; i < 2; ++i)
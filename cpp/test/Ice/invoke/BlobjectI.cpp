@@ -122,3 +122,31 @@ BlobjectArrayAsyncI::ice_invokeAsync(pair<const Ice::Byte*, const Ice::Byte*> in
     }
     response(ok, outPair);
 }
+
+ForwarderI::ForwarderI(Ice::ObjectPrx target) :
+    _target(std::move(target))
+{
+}
+
+void
+ForwarderI::ice_invokeAsync(pair<const Ice::Byte*, const Ice::Byte*> request,
+                            pair<const Ice::Byte*, const Ice::Byte*>,
+                            function<void(bool, const pair<const Ice::Byte*, const Ice::Byte*>&)> response,
+                            function<void(const pair<const Ice::Byte*, const Ice::Byte*>&)> reply,
+                            function<void(exception_ptr)> error,
+                            const Ice::Current& current)
+{
+    if(current.requestId == 0)
+    {
+        _target->ice_oneway()->ice_forwardAsync(request, nullptr, error,
+                                                [response = std::move(response)](bool)
+                                                {
+                                                    response(true, { nullptr, nullptr });
+                                                },
+                                                current);
+    }
+    else
+    {
+        _target->ice_forwardAsync(request, std::move(reply), error, nullptr, current);
+    }
+}
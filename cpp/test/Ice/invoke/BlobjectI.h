@@ -42,4 +42,22 @@ public:
                                  const Ice::Current&);
 };
 
+class ForwarderI : public Ice::BlobjectForwardAsync
+{
+public:
+
+    ForwarderI(Ice::ObjectPrx);
+
+    virtual void ice_invokeAsync(std::pair<const Ice::Byte*, const Ice::Byte*>,
+                                 std::pair<const Ice::Byte*, const Ice::Byte*>,
+                                 std::function<void(bool, const std::pair<const Ice::Byte*, const Ice::Byte*>&)>,
+                                 std::function<void(const std::pair<const Ice::Byte*, const Ice::Byte*>&)>,
+                                 std::function<void(std::exception_ptr)>,
+                                 const Ice::Current&);
+
+private:
+
+    const Ice::ObjectPrx _target;
+};
+
 #endif
@@ -57,6 +57,49 @@ private:
     shared_ptr<Ice::Object> _blobject;
 };
 
+//
+// The locator of the forwarder's target. The first lookup returns an adapter
+// without servants, the forwarded request must be retried after the object
+// not exist reply clears the locator cache.
+//
+class LocatorI final : public Ice::Locator
+{
+public:
+
+    LocatorI(Ice::ObjectPrx empty, Ice::ObjectPrx backend) :
+        _empty(std::move(empty)),
+        _backend(std::move(backend))
+    {
+    }
+
+    void findObjectByIdAsync(Ice::Identity id,
+                             function<void(const optional<Ice::ObjectPrx>&)> response,
+                             function<void(exception_ptr)>,
+                             const Ice::Current&) const final
+    {
+        response((_lookups++ == 0 ? _empty : _backend)->ice_identity(id));
+    }
+
+    void findAdapterByIdAsync(string,
+                              function<void(const optional<Ice::ObjectPrx>&)> response,
+                              function<void(exception_ptr)>,
+                              const Ice::Current&) const final
+    {
+        response(nullopt);
+    }
+
+    optional<Ice::LocatorRegistryPrx> getRegistry(const Ice::Current&) const final
+    {
+        return nullopt;
+    }
+
+private:
+
+    const Ice::ObjectPrx _empty;
+    const Ice::ObjectPrx _backend;
+    mutable atomic<int> _lookups = 0;
+};
+
 class Server : public Test::TestHelper
 {
 public:
@@ -71,6 +114,7 @@ Server::run(int argc, char** argv)
     IceUtilInternal::Options opts;
     opts.addOpt("", "array");
     opts.addOpt("", "async");
+    opts.addOpt("", "forward");
 
     vector<string> args;
     try
@@ -87,7 +131,31 @@ Server::run(int argc, char** argv)
 
     communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
     Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
-    adapter->addServantLocator(make_shared<ServantLocatorI>(array, async), "");
+    if(opts.isSet("forward"))
+    {
+        //
+        // The requests are forwarded to the backend adapter with a well-known proxy.
+        //
+        communicator->getProperties()->setProperty("BackendAdapter.Endpoints", getTestEndpoint(1));
+        Ice::ObjectAdapterPtr backend = communicator->createObjectAdapter("BackendAdapter");
+        backend->addServantLocator(make_shared<ServantLocatorI>(true, true), "");
+        backend->activate();
+
+        communicator->getProperties()->setProperty("EmptyAdapter.Endpoints", getTestEndpoint(2));
+        Ice::ObjectAdapterPtr empty = communicator->createObjectAdapter("EmptyAdapter");
+        empty->activate();
+
+        Ice::Identity id = Ice::stringToIdentity("locator");
+        backend->add(make_shared<LocatorI>(empty->createProxy(id), backend->createProxy(id)), id);
+        auto locator = Ice::uncheckedCast<Ice::LocatorPrx>(backend->createProxy(id));
+
+        Ice::ObjectPrx target = communicator->stringToProxy("test")->ice_locator(locator);
+        adapter->addDefaultServant(make_shared<ForwarderI>(target), "");
+    }
+    else
+    {
+        adapter->addServantLocator(make_shared<ServantLocatorI>(array, async), "");
+    }
     adapter->activate();
 
     serverReady();
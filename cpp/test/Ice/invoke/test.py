@@ -15,5 +15,8 @@ TestSuite(
         ClientServerTestCase(
             name="client/server async", servers=[Server(args=["--async"])]
         ),
+        ClientServerTestCase(
+            name="client/server forward", servers=[Server(args=["--forward"])]
+        ),
     ],
 )
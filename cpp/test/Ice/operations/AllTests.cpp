@@ -52,5 +52,43 @@ allTests(Test::TestHelper* helper)
     batchOnewaysAMI(derived);
     cout << "ok" << endl;
 
+    cout << "testing marshaled result stream reuse... " << flush;
+    {
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+        Ice::Current current;
+        current.adapter = adapter;
+        current.requestId = 1;
+
+        Ice::OutputStream* stream;
+        size_t size;
+        {
+            Ice::MarshaledResult result(current);
+            stream = result.getOutputStream().get();
+            size = stream->b.size();
+            stream->write(string(1000, 'a'));
+        }
+
+        //
+        // The stream of a released result is reused, and it's reset.
+        //
+        {
+            Ice::MarshaledResult result(current);
+            test(result.getOutputStream().get() == stream);
+            test(stream->b.size() == size);
+        }
+
+        //
+        // The stream isn't reused while a reference to it is held.
+        //
+        {
+            Ice::MarshaledResult result1(current);
+            shared_ptr<Ice::OutputStream> held = result1.getOutputStream();
+            Ice::MarshaledResult result2(current);
+            test(result2.getOutputStream() != held);
+        }
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
     return cl;
 }
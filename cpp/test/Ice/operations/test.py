@@ -0,0 +1,32 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+from Util import (
+    ClientAMDServerTestCase,
+    ClientServerTestCase,
+    CollocatedTestCase,
+    TestSuite,
+)
+
+
+reactorProps = {
+    "Ice.ThreadPool.Client.Reactors": 2,
+    "Ice.ThreadPool.Server.Reactors": 3,
+}
+
+lz4Props = {
+    "Ice.Compression.Codec": "lz4",
+    "Ice.Override.Compress": 1,
+}
+
+TestSuite(
+    __file__,
+    [
+        ClientServerTestCase(),
+        ClientAMDServerTestCase(),
+        CollocatedTestCase(),
+        ClientServerTestCase(name="client/server with reactors", props=reactorProps),
+        ClientServerTestCase(name="client/server with lz4 compression", props=lz4Props),
+    ],
+)
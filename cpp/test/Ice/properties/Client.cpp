@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Ice.h>
+#include <Ice/Instance.h>
 #include <TestHelper.h>
 #include <fstream>
 
@@ -10,6 +11,45 @@ using namespace std;
 
 string configPath;
 
+namespace
+{
+
+class WarningLogger final : public Ice::Logger, public enable_shared_from_this<WarningLogger>
+{
+public:
+
+    void print(const string&) final
+    {
+    }
+
+    void trace(const string&, const string&) final
+    {
+    }
+
+    void warning(const string& message) final
+    {
+        warnings.push_back(message);
+    }
+
+    void error(const string&) final
+    {
+    }
+
+    string getPrefix() final
+    {
+        return "";
+    }
+
+    Ice::LoggerPtr cloneWithPrefix(const string&) final
+    {
+        return shared_from_this();
+    }
+
+    vector<string> warnings;
+};
+
+}
+
 class Client : public Test::TestHelper
 {
 public:
@@ -92,6 +132,65 @@ Client::run(int, char**)
         }
         cout << "ok" << endl;
     }
+
+    {
+        cout << "testing buffer pool configuration... " << flush;
+
+        //
+        // The buffer pool is configured by the first communicator, the other
+        // communicators warn if their settings differ.
+        //
+        auto logger = make_shared<WarningLogger>();
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties();
+        initData.properties->setProperty("Ice.BufferPool.SizeMax", "32");
+        initData.logger = logger;
+        Ice::CommunicatorHolder communicator1 = Ice::initialize(initData);
+        Ice::CommunicatorHolder communicator2 = Ice::initialize(initData);
+        test(logger->warnings.empty());
+
+        initData.properties = initData.properties->clone();
+        initData.properties->setProperty("Ice.BufferPool.SizeMax", "128");
+        Ice::CommunicatorHolder communicator3 = Ice::initialize(initData);
+        test(logger->warnings.size() == 1);
+        test(logger->warnings[0].find("Ice.BufferPool") != string::npos);
+        cout << "ok" << endl;
+
+        cout << "testing buffer pool statistics... " << flush;
+
+        //
+        // The statistics are process-wide, the communicators report the same statistics.
+        //
+        IceInternal::InstancePtr instance = IceInternal::getInstance(communicator1.communicator());
+        IceInternal::BufferPool::Stats stats = instance->bufferPoolStats();
+        test(stats.misses == stats.allocations - stats.hits);
+
+        //
+        // The first buffer of a size class is a cache miss, the buffers allocated once it's
+        // released are cache hits.
+        //
+        {
+            Ice::OutputStream out(communicator1.communicator());
+            out.writeBlob(vector<Ice::Byte>(20000));
+        }
+        IceInternal::BufferPool::Stats stats1 = instance->bufferPoolStats();
+        test(stats1.allocations > stats.allocations);
+        test(stats1.misses > stats.misses);
+        test(stats1.cachedBytes >= 32768);
+
+        for(int i = 0; i < 10; ++i)
+        {
+            Ice::OutputStream out(communicator2.communicator());
+            out.writeBlob(vector<Ice::Byte>(20000));
+        }
+        IceInternal::BufferPool::Stats stats2 =
+            IceInternal::getInstance(communicator2.communicator())->bufferPoolStats();
+        test(stats2.allocations >= stats1.allocations + 10);
+        test(stats2.hits >= stats1.hits + 10);
+        test(stats2.misses == stats2.allocations - stats2.hits);
+        test(stats2.cachedBytes == stats1.cachedBytes);
+        cout << "ok" << endl;
+    }
 }
 
 DEFINE_TEST(Client)
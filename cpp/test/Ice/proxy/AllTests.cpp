@@ -486,6 +486,13 @@ allTests(Test::TestHelper* helper)
     test(!b1->ice_isConnectionCached());
     prop->setProperty(property, "");
 
+    property = propertyPrefix + ".ConnectionPoolSize";
+    test(b1->ice_getConnectionPoolSize() == 1);
+    prop->setProperty(property, "4");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getConnectionPoolSize() == 4);
+    prop->setProperty(property, "");
+
     property = propertyPrefix + ".InvocationTimeout";
     test(b1->ice_getInvocationTimeout() == -1);
     prop->setProperty(property, "1000");
@@ -501,6 +508,9 @@ allTests(Test::TestHelper* helper)
     prop->setProperty(property, "Ordered");
     b1 = communicator->propertyToProxy(propertyPrefix);
     test(b1->ice_getEndpointSelection() == Ice::EndpointSelectionType::Ordered);
+    prop->setProperty(property, "Adaptive");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getEndpointSelection() == Ice::EndpointSelectionType::Adaptive);
     prop->setProperty(property, "");
 
     property = propertyPrefix + ".CollocationOptimized";
@@ -585,6 +595,10 @@ allTests(Test::TestHelper* helper)
     test(proxyProps["Test.Locator.Router.LocatorCacheTimeout"] == "200");
     test(proxyProps["Test.Locator.Router.InvocationTimeout"] == "1500");
 
+    proxyProps = communicator->proxyToProperty(b1->ice_connectionPoolSize(3), "Test");
+    test(proxyProps.size() == 22);
+    test(proxyProps["Test.ConnectionPoolSize"] == "3");
+
     cout << "ok" << endl;
 
     cout << "testing ice_getCommunicator... " << flush;
@@ -694,6 +708,24 @@ allTests(Test::TestHelper* helper)
     {
     }
 
+    try
+    {
+        test(base->ice_connectionPoolSize(3)->ice_getConnectionPoolSize() == 3);
+    }
+    catch(const invalid_argument&)
+    {
+        test(false);
+    }
+
+    try
+    {
+        base->ice_connectionPoolSize(0);
+        test(false);
+    }
+    catch(const invalid_argument&)
+    {
+    }
+
     cout << "ok" << endl;
 
     cout << "testing proxy comparison... " << flush;
@@ -724,6 +756,11 @@ allTests(Test::TestHelper* helper)
     test(compObj->ice_connectionCached(false) < compObj->ice_connectionCached(true));
     test(compObj->ice_connectionCached(true) >= compObj->ice_connectionCached(false));
 
+    test(compObj->ice_connectionPoolSize(2) == compObj->ice_connectionPoolSize(2));
+    test(compObj->ice_connectionPoolSize(1) != compObj->ice_connectionPoolSize(2));
+    test(compObj->ice_connectionPoolSize(1) < compObj->ice_connectionPoolSize(2));
+    test(compObj->ice_connectionPoolSize(2) >= compObj->ice_connectionPoolSize(1));
+
     test(compObj->ice_endpointSelection(Ice::EndpointSelectionType::Random) == compObj->ice_endpointSelection(Ice::EndpointSelectionType::Random));
     test(compObj->ice_endpointSelection(Ice::EndpointSelectionType::Random) != compObj->ice_endpointSelection(Ice::EndpointSelectionType::Ordered));
     test(compObj->ice_endpointSelection(Ice::EndpointSelectionType::Random) < compObj->ice_endpointSelection(Ice::EndpointSelectionType::Ordered));
@@ -0,0 +1,280 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <Ice/ThreadPool.h>
+#include <Ice/Network.h>
+#include <TestHelper.h>
+
+#include <thread>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+const int producerCount = 4;
+const int connectionCount = 4;
+const int itemCount = 1000;
+
+//
+// Records the order in which the work items of each producer and connection are taken
+// from the work queue.
+//
+class Recorder
+{
+public:
+
+    Recorder() : _last(producerCount * connectionCount, -1), _count(0), _ordered(true)
+    {
+    }
+
+    void taken(int producer, int connection, int sequence)
+    {
+        lock_guard lock(_mutex);
+        int& last = _last[static_cast<size_t>(producer * connectionCount + connection)];
+        if(sequence != last + 1)
+        {
+            _ordered = false;
+        }
+        last = sequence;
+        ++_count;
+        _condition.notify_all();
+    }
+
+    void waitForCount(int count)
+    {
+        unique_lock lock(_mutex);
+        while(_count < count)
+        {
+            if(_condition.wait_for(lock, chrono::seconds(30)) == cv_status::timeout)
+            {
+                test(false);
+            }
+        }
+    }
+
+    bool ordered()
+    {
+        lock_guard lock(_mutex);
+        return _ordered;
+    }
+
+private:
+
+    mutex _mutex;
+    condition_variable _condition;
+    vector<int> _last;
+    int _count;
+    bool _ordered;
+};
+
+class OrderedWorkItem final : public DispatchWorkItem
+{
+public:
+
+    OrderedWorkItem(const ConnectionPtr& connection, Recorder& recorder, int producer, int index, int sequence) :
+        DispatchWorkItem(connection),
+        _recorder(recorder),
+        _producer(producer),
+        _index(index),
+        _sequence(sequence)
+    {
+    }
+
+    void run() final
+    {
+        this_thread::yield();
+    }
+
+private:
+
+    void execute(ThreadPoolCurrent& current) final
+    {
+        //
+        // Record the work item before promoting a follower: with the leader/follower
+        // thread pool, no other thread takes a work item from the queue until then.
+        //
+        _recorder.taken(_producer, _index, _sequence);
+        current.ioCompleted();
+        current.dispatchFromThisThread(shared_from_this());
+    }
+
+    Recorder& _recorder;
+    const int _producer;
+    const int _index;
+    const int _sequence;
+};
+
+class CountWorkItem final : public DispatchWorkItem
+{
+public:
+
+    CountWorkItem(const ConnectionPtr& connection, atomic<int>& count) :
+        DispatchWorkItem(connection),
+        _count(count)
+    {
+    }
+
+    void run() final
+    {
+        ++_count;
+    }
+
+private:
+
+    atomic<int>& _count;
+};
+
+void
+testOrder(const InstancePtr& instance, const string& prefix, const vector<ConnectionPtr>& connections)
+{
+    ThreadPoolPtr threadPool = ThreadPool::create(instance, prefix, 0);
+    Recorder recorder;
+    atomic<int> calls(0);
+
+    vector<thread> producers;
+    for(int p = 0; p < producerCount; ++p)
+    {
+        producers.emplace_back([&, p]()
+        {
+            for(int i = 0; i < itemCount; ++i)
+            {
+                for(int c = 0; c < connectionCount; ++c)
+                {
+                    threadPool->dispatch(make_shared<OrderedWorkItem>(connections[static_cast<size_t>(c)],
+                                                                      recorder, p, c, i));
+                }
+                threadPool->dispatch([&calls]() { ++calls; });
+            }
+        });
+    }
+    for(auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    recorder.waitForCount(producerCount * connectionCount * itemCount);
+#if !defined(ICE_USE_IOCP)
+    //
+    // With IOCP, the threads take work items concurrently and can record them out of order.
+    //
+    test(recorder.ordered());
+#endif
+
+    threadPool->destroy();
+    threadPool->joinWithAllThreads();
+    test(calls == producerCount * itemCount);
+}
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    virtual void run(int argc, char* argv[]);
+};
+
+void
+Client::run(int argc, char* argv[])
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    properties->setProperty("TestPool.Size", "2");
+    properties->setProperty("TestPool.SizeMax", "8");
+    properties->setProperty("TestPool.SizeWarn", "0");
+    properties->setProperty("TestReactorPool.Size", "2");
+    properties->setProperty("TestReactorPool.SizeMax", "4");
+    properties->setProperty("TestReactorPool.SizeWarn", "0");
+    properties->setProperty("TestReactorPool.Reactors", "2");
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", getTestEndpoint());
+
+    ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->activate();
+
+    //
+    // The work items of a connection are queued on the lane of the connection.
+    //
+    vector<ConnectionPtr> connections;
+    for(int i = 0; i < connectionCount; ++i)
+    {
+        auto prx = communicator->stringToProxy("test:" + getTestEndpoint())->ice_collocationOptimized(false);
+        connections.push_back(prx->ice_connectionId("c" + to_string(i))->ice_getConnection());
+        test(connections.back());
+    }
+
+    InstancePtr instance = getInstance(communicator.communicator());
+
+    cout << "testing work item order... " << flush;
+    testOrder(instance, "TestPool", connections);
+    cout << "ok" << endl;
+
+    cout << "testing work item order with reactors... " << flush;
+    testOrder(instance, "TestReactorPool", connections);
+    cout << "ok" << endl;
+
+    cout << "testing destroy with concurrent dispatch... " << flush;
+    {
+        for(int i = 0; i < 5; ++i)
+        {
+            ThreadPoolPtr threadPool = ThreadPool::create(instance, "TestPool", 0);
+            atomic<int> dispatched(0);
+            atomic<int> ran(0);
+
+            vector<thread> producers;
+            for(int p = 0; p < producerCount; ++p)
+            {
+                producers.emplace_back([&, p]()
+                {
+                    for(int n = 0;; ++n)
+                    {
+                        try
+                        {
+                            if(n % 2 == 0)
+                            {
+                                threadPool->dispatch([&ran]() { ++ran; });
+                            }
+                            else
+                            {
+                                auto& connection = connections[static_cast<size_t>((n + p) % connectionCount)];
+                                threadPool->dispatch(make_shared<CountWorkItem>(connection, ran));
+                            }
+                            ++dispatched;
+                        }
+                        catch(const CommunicatorDestroyedException&)
+                        {
+                            break;
+                        }
+
+                        if(dispatched - ran > 1000)
+                        {
+                            this_thread::yield();
+                        }
+                    }
+                });
+            }
+
+            this_thread::sleep_for(chrono::milliseconds(50));
+            threadPool->destroy();
+            for(auto& producer : producers)
+            {
+                producer.join();
+            }
+            threadPool->joinWithAllThreads();
+
+            //
+            // The work items queued before the thread pool was destroyed all ran before
+            // its threads terminated.
+            //
+            test(dispatched > 0);
+            test(ran == dispatched);
+        }
+    }
+    cout << "ok" << endl;
+}
+
+DEFINE_TEST(Client)
@@ -65,6 +65,49 @@ allTests(Test::TestHelper* helper)
     cl->ice_ping();
     cout << "ok" << endl;
 
+    cout << "testing facets and exceptions... " << flush;
+    {
+        //
+        // The bridge forwards the identity, facet and context of the requests.
+        //
+        auto f = Ice::checkedCast<Test::MyClassPrx>(cl, "facet");
+        test(f && f->ice_getFacet() == "facet");
+        f->incCounter(1);
+        f->waitCounter(1);
+
+        try
+        {
+            cl->ice_facet("missing")->ice_ping();
+            test(false);
+        }
+        catch(const Ice::FacetNotExistException& ex)
+        {
+            test(ex.id == cl->ice_getIdentity() && ex.facet == "missing");
+        }
+
+        try
+        {
+            cl->ice_identity(Ice::stringToIdentity("missing"))->ice_ping();
+            test(false);
+        }
+        catch(const Ice::ObjectNotExistException& ex)
+        {
+            test(ex.id == Ice::stringToIdentity("missing"));
+        }
+
+        try
+        {
+            vector<Ice::Byte> inEncaps, outEncaps;
+            cl->ice_invoke("missing", Ice::OperationMode::Normal, inEncaps, outEncaps);
+            test(false);
+        }
+        catch(const Ice::OperationNotExistException& ex)
+        {
+            test(ex.operation == "missing");
+        }
+    }
+    cout << "ok" << endl;
+
     cout << "testing datagrams... " << flush;
     {
         for(int i = 0; i < 20; i++)
@@ -30,6 +30,7 @@ Server::run(int argc, char** argv)
                                                      getTestEndpoint("udp"));
     auto adapter = communicatorHolder->createObjectAdapter("TestAdapter");
     adapter->add(make_shared<MyClassI>(), Ice::stringToIdentity("test"));
+    adapter->addFacet(make_shared<MyClassI>(), Ice::stringToIdentity("test"), "facet");
     adapter->activate();
     serverReady();
     communicatorHolder->waitForShutdown();
@@ -26,8 +26,8 @@ public:
     void
     event(int i, const Current& current) override
     {
-        if((_name == "default" || _name == "oneway" || _name == "batch" || _name == "datagram" ||
-            _name == "batch datagram") && current.requestId != 0)
+        if((_name == "default" || _name == "oneway" || _name == "batch" || _name == "batch qos" ||
+            _name == "datagram" || _name == "batch datagram") && current.requestId != 0)
         {
             cerr << endl << "expected oneway request";
             test(false);
@@ -198,6 +198,16 @@ Subscriber::run(int argc, char** argv)
         subscriberIdentities.push_back(object->ice_getIdentity());
         topic->subscribeAndGetPublisher(IceStorm::QoS(), object);
     }
+    {
+        subscribers.push_back(make_shared<SingleI>("batch qos"));
+        IceStorm::QoS qos;
+        qos["batch"] = "10";
+        qos["latency"] = "50";
+        qos["maxOutstanding"] = "2";
+        auto object = adapter->addWithUUID(subscribers.back())->ice_oneway();
+        subscriberIdentities.push_back(object->ice_getIdentity());
+        topic->subscribeAndGetPublisher(qos, object);
+    }
     {
         subscribers.push_back(make_shared<SingleI>("twoway ordered")); // Ordered
         IceStorm::QoS qos;
@@ -17,6 +17,9 @@ from Util import ClientServerTestCase, TestSuite
 props = {"Ice.UDP.SndSize": 512 * 1024, "Ice.Warn.Dispatch": 0}
 persistent = IceStorm(props=props)
 transient = IceStorm(props=props, transient=True)
+shardedProps = dict(props, **{"IceStorm.Fanout.Shards": 3})
+sharded = IceStorm(props=shardedProps)
+shardedTransient = IceStorm(props=shardedProps, transient=True)
 replicated = [IceStorm(replica=i, nreplicas=3, props=props) for i in range(0, 3)]
 
 sub = Subscriber(
@@ -49,6 +52,16 @@ TestSuite(
             icestorm=transient,
             client=ClientServerTestCase(client=pub, server=sub),
         ),
+        IceStormSingleTestCase(
+            "persistent sharded",
+            icestorm=sharded,
+            client=ClientServerTestCase(client=pub, server=sub),
+        ),
+        IceStormSingleTestCase(
+            "transient sharded",
+            icestorm=shardedTransient,
+            client=ClientServerTestCase(client=pub, server=sub),
+        ),
         IceStormSingleTestCase(
             "replicated",
             icestorm=replicated,
@@ -279,6 +279,7 @@ Subscriber::run(int argc, char** argv)
     opts.addOpt("", "erratic", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "maxQueueDropEvents", IceUtilInternal::Options::NeedArg);
     opts.addOpt("", "maxQueueRemoveSub", IceUtilInternal::Options::NeedArg);
+    opts.addOpt("", "maxQueueSpill");
 
     try
     {
@@ -322,6 +323,7 @@ Subscriber::run(int argc, char** argv)
     bool slow = opts.isSet("slow");
     int maxQueueDropEvents = opts.isSet("maxQueueDropEvents") ? atoi(opts.optArg("maxQueueDropEvents").c_str()) : 0;
     int maxQueueRemoveSub = opts.isSet("maxQueueRemoveSub") ? atoi(opts.optArg("maxQueueRemoveSub").c_str()) : 0;
+    bool maxQueueSpill = opts.isSet("maxQueueSpill");
     bool erratic = false;
     int erraticNum = 0;
     s = opts.optArg("erratic");
@@ -379,7 +381,7 @@ Subscriber::run(int argc, char** argv)
         item.qos = cmdLineQos;
         subs.push_back(item);
     }
-    else if(maxQueueDropEvents || maxQueueRemoveSub)
+    else if(maxQueueDropEvents || maxQueueRemoveSub || maxQueueSpill)
     {
         Subscription item1;
         item1.adapter = communicator->createObjectAdapterWithEndpoints("MaxQueueAdapter", "default");
@@ -387,6 +389,14 @@ Subscriber::run(int argc, char** argv)
         {
             item1.servant = make_shared<MaxQueueEventI>(communicator.communicator(), maxQueueDropEvents, events, false);
         }
+        else if(maxQueueSpill)
+        {
+            //
+            // The events which don't fit in the queue are spilled to disk, all the events
+            // must be received in order.
+            //
+            item1.servant = make_shared<OrderEventI>(communicator.communicator(), events);
+        }
         else
         {
             item1.servant = make_shared<MaxQueueEventI>(communicator.communicator(), maxQueueRemoveSub, events, true);
@@ -7,6 +7,9 @@
 # Publisher/subscriber test cases, publisher publishes on TestIceStorm1 instance(s) and
 # the subscriber subscribes to the TestIceStorm2 instance(s)
 #
+import os
+import shutil
+
 from IceStormUtil import IceStorm, IceStormTestCase, Publisher, Subscriber
 from Util import ClientServerTestCase, TestSuite
 
@@ -206,6 +209,89 @@ class IceStormStressTestCase(IceStormTestCase):
             s.stop(current, True)
         current.writeln("ok")
 
+        spillPath = os.path.join(current.testsuite.getPath(), "spill")
+
+        def checkSpillPath():
+            if os.path.exists(spillPath):
+                if os.listdir(spillPath):
+                    raise RuntimeError(
+                        "spill files not removed: {0}".format(os.listdir(spillPath))
+                    )
+                shutil.rmtree(spillPath)
+
+        current.write(
+            "Sending 5000 ordered events with max queue size spill to disk... "
+        )
+        opts = (
+            " --IceStorm.Send.QueueSizeMax=100 --IceStorm.Send.QueueSizeMaxPolicy=SpillToDisk"
+            + " --IceStorm.Send.Spill.Path="
+            + spillPath
+        )
+        for s in icestorm1:
+            s.start(current, args=opts.split(" "))
+        doTest(
+            (
+                "TestIceStorm1",
+                '--events 5000 --qos "reliability,ordered" --maxQueueSpill',
+            ),
+            "--events 5000 --maxQueueTest",
+        )
+        for s in icestorm1:
+            s.shutdown(current)
+            s.stop(current, True)
+        checkSpillPath()
+        current.writeln("ok")
+
+        current.write(
+            "Sending 5000 ordered events with max spill size remove subscriber... "
+        )
+        opts += " --IceStorm.Send.Spill.SizeMax=4"
+        for s in icestorm1:
+            s.start(current, args=opts.split(" "))
+        doTest(
+            (
+                "TestIceStorm1",
+                '--events 5000 --qos "reliability,ordered" --maxQueueRemoveSub=100',
+            ),
+            "--events 5000 --maxQueueTest",
+        )
+        for s in icestorm1:
+            s.shutdown(current)
+            s.stop(current, True)
+        checkSpillPath()
+        current.writeln("ok")
+
+        #
+        # With publish shards and a small shard queue, the publisher waits for
+        # the shard threads to catch up. The subscribers are spread across the
+        # shards and must still receive the events in order.
+        #
+        current.write("Sending 5000 ordered events across publish shards... ")
+        opts = " --IceStorm.Fanout.Shards=3 --IceStorm.Fanout.QueueSizeMax=10"
+        for s in icestorm1:
+            s.start(current, args=opts.split(" "))
+        doTest(
+            [("TestIceStorm1", '--events 5000 --qos "reliability,ordered"')] * 3,
+            "--events 5000",
+        )
+        current.writeln("ok")
+
+        current.write(
+            "Sending 20000 unordered events with slow subscriber across publish shards... "
+        )
+        doTest(
+            [
+                ("TestIceStorm1", "--events 2 --slow"),
+                ("TestIceStorm1", "--events 20000"),
+                ("TestIceStorm1", "--events 20000"),
+            ],
+            "--events 20000 --oneway",
+        )
+        for s in icestorm1:
+            s.shutdown(current)
+            s.stop(current, True)
+        current.writeln("ok")
+
 
 TestSuite(
     __file__,
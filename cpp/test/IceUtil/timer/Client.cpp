@@ -163,87 +163,136 @@ public:
 };
 
 void
-Client::run(int, char*[])
+testTimer(const IceUtil::TimerPtr& timer)
 {
-    cout << "testing timer... " << flush;
     {
-        auto timer = make_shared<IceUtil::Timer>();
+        TestTaskPtr task = make_shared<TestTask>();
+        timer->schedule(task, chrono::seconds::zero());
+        task->waitForRun();
+        task->clear();
+        //
+        // Verify that the same task cannot be scheduled more than once.
+        //
+        timer->schedule(task, chrono::milliseconds(100));
+        try
         {
-            TestTaskPtr task = make_shared<TestTask>();
             timer->schedule(task, chrono::seconds::zero());
-            task->waitForRun();
-            task->clear();
-            //
-            // Verify that the same task cannot be scheduled more than once.
-            //
-            timer->schedule(task, chrono::milliseconds(100));
-            try
-            {
-                timer->schedule(task, chrono::seconds::zero());
-            }
-            catch(const IceUtil::IllegalArgumentException&)
-            {
-                // Expected.
-            }
-            task->waitForRun();
-            task->clear();
         }
-
+        catch(const IceUtil::IllegalArgumentException&)
         {
-            TestTaskPtr task = make_shared<TestTask>();
-            test(!timer->cancel(task));
-            timer->schedule(task, chrono::seconds(1));
-            test(!task->hasRun() && timer->cancel(task) && !task->hasRun());
-            test(!timer->cancel(task));
-            this_thread::sleep_for(chrono::milliseconds(1100));
-            test(!task->hasRun());
+            // Expected.
         }
+        task->waitForRun();
+        task->clear();
+    }
 
+    {
+        TestTaskPtr task = make_shared<TestTask>();
+        test(!timer->cancel(task));
+        timer->schedule(task, chrono::seconds(1));
+        test(!task->hasRun() && timer->cancel(task) && !task->hasRun());
+        test(!timer->cancel(task));
+        this_thread::sleep_for(chrono::milliseconds(1100));
+        test(!task->hasRun());
+    }
+
+    {
+        vector<TestTaskPtr> tasks;
+        auto start = chrono::steady_clock::now() + chrono::milliseconds(500);
+        for(int i = 0; i < 20; ++i)
         {
-            vector<TestTaskPtr> tasks;
-            auto start = chrono::steady_clock::now() + chrono::milliseconds(500);
-            for(int i = 0; i < 20; ++i)
-            {
-                tasks.push_back(make_shared<TestTask>(chrono::milliseconds(500 + i * 50)));
-            }
+            tasks.push_back(make_shared<TestTask>(chrono::milliseconds(500 + i * 50)));
+        }
 
-            IceUtilInternal::shuffle(tasks.begin(), tasks.end());
-            vector<TestTaskPtr>::const_iterator p;
-            for(p = tasks.begin(); p != tasks.end(); ++p)
-            {
-                timer->schedule(*p, (*p)->getScheduledTime());
-            }
+        IceUtilInternal::shuffle(tasks.begin(), tasks.end());
+        vector<TestTaskPtr>::const_iterator p;
+        for(p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            timer->schedule(*p, (*p)->getScheduledTime());
+        }
 
-            for(p = tasks.begin(); p != tasks.end(); ++p)
-            {
-                (*p)->waitForRun();
-            }
+        for(p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            (*p)->waitForRun();
+        }
 
-            test(chrono::steady_clock::now() > start);
+        test(chrono::steady_clock::now() > start);
 
-            sort(tasks.begin(), tasks.end(), TargetLess<shared_ptr<TestTask>>());
-            for(p = tasks.begin(); p + 1 != tasks.end(); ++p)
+        sort(tasks.begin(), tasks.end(), TargetLess<shared_ptr<TestTask>>());
+        for(p = tasks.begin(); p + 1 != tasks.end(); ++p)
+        {
+            if((*p)->getRunTime() > (*(p + 1))->getRunTime())
             {
-                if((*p)->getRunTime() > (*(p + 1))->getRunTime())
-                {
-                    test(false);
-                }
+                test(false);
             }
         }
+    }
+
+    {
+        TestTaskPtr task = make_shared<TestTask>();
+        timer->scheduleRepeated(task, chrono::milliseconds(20));
+        this_thread::sleep_for(chrono::milliseconds(500));
+        test(task->hasRun());
+        test(task->getCount() > 1);
+        test(task->getCount() < 26);
+        test(timer->cancel(task));
+        int count = task->getCount();
+        this_thread::sleep_for(chrono::milliseconds(100));
+        test(count == task->getCount() || count + 1 == task->getCount());
+    }
+
+    {
+        //
+        // Tasks scheduled beyond the first rotation of a timing wheel.
+        //
+        TestTaskPtr task1 = make_shared<TestTask>();
+        TestTaskPtr task2 = make_shared<TestTask>();
+        auto start = chrono::steady_clock::now();
+        timer->schedule(task1, chrono::milliseconds(2700));
+        timer->schedule(task2, chrono::milliseconds(2600));
+        task1->waitForRun();
+        task2->waitForRun();
+        test(task2->getRunTime() - start >= chrono::milliseconds(2600));
+        test(task1->getRunTime() - start >= chrono::milliseconds(2700));
+        test(task2->getRunTime() <= task1->getRunTime());
+    }
+
+    timer->destroy();
+}
 
+void
+Client::run(int, char*[])
+{
+    cout << "testing timer... " << flush;
+    testTimer(make_shared<IceUtil::Timer>());
+    cout << "ok" << endl;
+
+    cout << "testing timing wheel timer... " << flush;
+    testTimer(make_shared<IceUtil::Timer>(chrono::milliseconds(10)));
+    cout << "ok" << endl;
+
+    cout << "testing idle timing wheel timer... " << flush;
+    {
+        //
+        // The wheel doesn't advance while it's empty, tasks scheduled after the timer
+        // was idle must still run on time.
+        //
+        auto timer = make_shared<IceUtil::Timer>(chrono::milliseconds(1));
+        for(int i = 0; i < 2; ++i)
         {
-            TestTaskPtr task = make_shared<TestTask>();
-            timer->scheduleRepeated(task, chrono::milliseconds(20));
             this_thread::sleep_for(chrono::milliseconds(500));
-            test(task->hasRun());
-            test(task->getCount() > 1);
-            test(task->getCount() < 26);
-            test(timer->cancel(task));
-            int count = task->getCount();
-            this_thread::sleep_for(chrono::milliseconds(100));
-            test(count == task->getCount() || count + 1 == task->getCount());
+            TestTaskPtr task1 = make_shared<TestTask>();
+            TestTaskPtr task2 = make_shared<TestTask>();
+            auto start = chrono::steady_clock::now();
+            timer->schedule(task1, chrono::milliseconds(50));
+            timer->schedule(task2, chrono::milliseconds(400));
+            task1->waitForRun();
+            task2->waitForRun();
+            test(task1->getRunTime() - start >= chrono::milliseconds(50));
+            test(task1->getRunTime() - start < chrono::milliseconds(350));
+            test(task2->getRunTime() - start >= chrono::milliseconds(400));
+            test(task2->getRunTime() - start < chrono::milliseconds(700));
         }
-
         timer->destroy();
     }
     cout << "ok" << endl;
@@ -102,7 +102,8 @@ protected:
 
     bool prepareRequest(const OperationPtr&, PyObject*, MappingType, Ice::OutputStream*,
                         pair<const Ice::Byte*, const Ice::Byte*>&);
-    PyObject* unmarshalResults(const OperationPtr&, const pair<const Ice::Byte*, const Ice::Byte*>&);
+    PyObject* unmarshalResults(const OperationPtr&, const pair<const Ice::Byte*, const Ice::Byte*>&,
+                               const BufferPtr& = nullptr);
     PyObject* unmarshalException(const OperationPtr&, const pair<const Ice::Byte*, const Ice::Byte*>&);
     bool validateException(const OperationPtr&, PyObject*) const;
     void checkTwowayOnly(const OperationPtr&, const Ice::ObjectPrx&) const;
@@ -1489,7 +1490,8 @@ IcePy::Invocation::prepareRequest(const OperationPtr& op, PyObject* args, Mappin
 }
 
 PyObject*
-IcePy::Invocation::unmarshalResults(const OperationPtr& op, const pair<const Ice::Byte*, const Ice::Byte*>& bytes)
+IcePy::Invocation::unmarshalResults(const OperationPtr& op, const pair<const Ice::Byte*, const Ice::Byte*>& bytes,
+                                    const BufferPtr& buffer)
 {
     Py_ssize_t numResults = static_cast<Py_ssize_t>(op->outParams.size());
     if(op->returnType)
@@ -1507,6 +1509,7 @@ IcePy::Invocation::unmarshalResults(const OperationPtr& op, const pair<const Ice
         // This is necessary to support object unmarshaling (see ValueReader).
         //
         StreamUtil util;
+        util.setBytes(bytes, buffer);
         assert(!is.getClosure());
         is.setClosure(&util);
 
@@ -1577,6 +1580,7 @@ IcePy::Invocation::unmarshalException(const OperationPtr& op, const pair<const I
     // This is necessary to support object unmarshaling (see ValueReader).
     //
     StreamUtil util;
+    util.setBytes(bytes);
     assert(!is.getClosure());
     is.setClosure(&util);
 
@@ -1752,8 +1756,9 @@ IcePy::SyncTypedInvocation::invoke(PyObject* args, PyObject* /* kwds */)
                 //
                 // Unmarshal the results. If there is more than one value to be returned, then return them
                 // in a tuple of the form (result, outParam1, ...). Otherwise just return the value.
+                // The result bytes are moved to a buffer which is retained by python:nocopy sequences.
                 //
-                PyObjectHandle results = unmarshalResults(_op, rb);
+                PyObjectHandle results = unmarshalResults(_op, rb, make_shared<Buffer>(std::move(result)));
                 if(!results.get())
                 {
                     return 0;
@@ -2515,6 +2520,7 @@ IcePy::TypedUpcall::dispatch(
         // This is necessary to support object unmarshaling (see ValueReader).
         //
         StreamUtil util;
+        util.setBytes(inBytes);
         assert(!is.getClosure());
         is.setClosure(&util);
 
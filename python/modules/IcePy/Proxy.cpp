@@ -835,8 +835,10 @@ proxyIceGetEndpointSelection(ProxyObject* self,  PyObject* /*args*/)
 
     PyObjectHandle rnd = getAttr(cls, "Random", false);
     PyObjectHandle ord = getAttr(cls, "Ordered", false);
+    PyObjectHandle ada = getAttr(cls, "Adaptive", false);
     assert(rnd.get());
     assert(ord.get());
+    assert(ada.get());
 
     assert(self->proxy);
 
@@ -848,10 +850,14 @@ proxyIceGetEndpointSelection(ProxyObject* self,  PyObject* /*args*/)
         {
             type = rnd.get();
         }
-        else
+        else if(val == Ice::EndpointSelectionType::Ordered)
         {
             type = ord.get();
         }
+        else
+        {
+            type = ada.get();
+        }
     }
     catch(const Ice::Exception& ex)
     {
@@ -880,8 +886,10 @@ proxyIceEndpointSelection(ProxyObject* self, PyObject* args)
     Ice::EndpointSelectionType val;
     PyObjectHandle rnd = getAttr(cls, "Random", false);
     PyObjectHandle ord = getAttr(cls, "Ordered", false);
+    PyObjectHandle ada = getAttr(cls, "Adaptive", false);
     assert(rnd.get());
     assert(ord.get());
+    assert(ada.get());
     if(rnd.get() == type)
     {
         val = Ice::EndpointSelectionType::Random;
@@ -890,9 +898,13 @@ proxyIceEndpointSelection(ProxyObject* self, PyObject* args)
     {
         val = Ice::EndpointSelectionType::Ordered;
     }
+    else if(ada.get() == type)
+    {
+        val = Ice::EndpointSelectionType::Adaptive;
+    }
     else
     {
-        PyErr_Format(PyExc_ValueError, STRCAST("ice_endpointSelection requires Random or Ordered"));
+        PyErr_Format(PyExc_ValueError, STRCAST("ice_endpointSelection requires Random, Ordered or Adaptive"));
         return 0;
     }
 
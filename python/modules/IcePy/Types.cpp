@@ -20,8 +20,12 @@
 
 #include <IceUtil/DisableWarnings.h>
 
+#include <algorithm>
 #include <list>
 #include <limits>
+#include <cstring>
+#include <cctype>
+#include <cstdlib>
 
 using namespace std;
 using namespace IcePy;
@@ -77,10 +81,13 @@ struct BufferObject
 {
     PyObject_HEAD
     IcePy::BufferPtr* buffer;
+    const Ice::Byte* data;
+    Py_ssize_t size;
 };
 
 extern PyTypeObject TypeInfoType;
 extern PyTypeObject ExceptionInfoType;
+extern PyTypeObject BufferType;
 
 bool
 writeString(PyObject* p, Ice::OutputStream* os)
@@ -159,6 +166,46 @@ exceptionInfoDealloc(ExceptionInfoObject* self)
     Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
 }
 
+#ifdef WIN32
+extern "C"
+#endif
+static BufferObject*
+bufferNew(PyTypeObject* type, PyObject* /*args*/, PyObject* /*kwds*/)
+{
+    BufferObject* self = reinterpret_cast<BufferObject*>(type->tp_alloc(type, 0));
+    if(!self)
+    {
+        return 0;
+    }
+    self->buffer = 0;
+    self->data = 0;
+    self->size = 0;
+    return self;
+}
+
+#ifdef WIN32
+extern "C"
+#endif
+static void
+bufferDealloc(BufferObject* self)
+{
+    delete self->buffer;
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject*>(self));
+}
+
+#ifdef WIN32
+extern "C"
+#endif
+static int
+bufferGetBuffer(BufferObject* self, Py_buffer* view, int flags)
+{
+    //
+    // The buffer is read-only, PyBuffer_FillInfo fails if a writable buffer is requested.
+    //
+    return PyBuffer_FillInfo(view, reinterpret_cast<PyObject*>(self),
+                             const_cast<Ice::Byte*>(self->data), self->size, 1, flags);
+}
+
 #ifdef WIN32
 extern "C"
 #endif
@@ -278,13 +325,34 @@ addExceptionInfo(string_view id, const ExceptionInfoPtr& info)
     _exceptionInfoMap.insert(ExceptionInfoMap::value_type(id, info));
 }
 
+//
+// Buffer implementation
+//
+IcePy::Buffer::Buffer(vector<Ice::Byte>&& bytes) :
+    _bytes(std::move(bytes))
+{
+}
+
+const Ice::Byte*
+IcePy::Buffer::begin() const
+{
+    return _bytes.data();
+}
+
+const Ice::Byte*
+IcePy::Buffer::end() const
+{
+    return _bytes.data() + _bytes.size();
+}
+
 //
 // StreamUtil implementation
 //
 PyObject* IcePy::StreamUtil::_slicedDataType = 0;
 PyObject* IcePy::StreamUtil::_sliceInfoType = 0;
 
-IcePy::StreamUtil::StreamUtil()
+IcePy::StreamUtil::StreamUtil() :
+    _bytes(nullptr, nullptr)
 {
 }
 
@@ -323,6 +391,48 @@ IcePy::StreamUtil::add(const ValueReaderPtr& reader)
     _readers.insert(reader);
 }
 
+void
+IcePy::StreamUtil::setBytes(const pair<const Ice::Byte*, const Ice::Byte*>& bytes, const BufferPtr& buffer)
+{
+    assert(!buffer || (buffer->begin() == bytes.first && buffer->end() == bytes.second));
+    _bytes = bytes;
+    _buffer = buffer;
+}
+
+PyObject*
+IcePy::StreamUtil::createView(const char* data, Py_ssize_t size)
+{
+    const Ice::Byte* begin = reinterpret_cast<const Ice::Byte*>(data);
+    if(begin < _bytes.first || begin + size > _bytes.second)
+    {
+        //
+        // Not stream bytes, the stream copies the sequence bytes if they're not aligned
+        // or need to be swapped.
+        //
+        return 0;
+    }
+
+    if(!_buffer)
+    {
+        _buffer = make_shared<Buffer>(vector<Ice::Byte>(_bytes.first, _bytes.second));
+    }
+
+    PyObjectHandle buffer = createBuffer(_buffer, _buffer->begin() + (begin - _bytes.first), size);
+    if(!buffer.get())
+    {
+        assert(PyErr_Occurred());
+        throw AbortMarshaling();
+    }
+
+    PyObject* view = PyMemoryView_FromObject(buffer.get());
+    if(!view)
+    {
+        assert(PyErr_Occurred());
+        throw AbortMarshaling();
+    }
+    return view;
+}
+
 void
 IcePy::StreamUtil::updateSlicedData()
 {
@@ -1231,6 +1341,195 @@ convertDataMembers(PyObject* members, DataMemberList& reqMembers, DataMemberList
     }
 }
 
+//
+// Marshal a primitive struct member, returns false if the value isn't valid. The value
+// is converted once instead of once by PrimitiveInfo::validate and once by
+// PrimitiveInfo::marshal.
+//
+static bool
+marshalPrimitiveMember(PrimitiveInfo::Kind kind, PyObject* p, Ice::OutputStream* os)
+{
+    switch(kind)
+    {
+    case PrimitiveInfo::KindBool:
+    {
+        int isTrue = PyObject_IsTrue(p);
+        if(isTrue < 0)
+        {
+            return false;
+        }
+        os->write(isTrue ? true : false);
+        return true;
+    }
+    case PrimitiveInfo::KindByte:
+    {
+        long val = PyLong_AsLong(p);
+        if(PyErr_Occurred() || val < 0 || val > 255)
+        {
+            return false;
+        }
+        os->write(static_cast<Ice::Byte>(val));
+        return true;
+    }
+    case PrimitiveInfo::KindShort:
+    {
+        long val = PyLong_AsLong(p);
+        if(PyErr_Occurred() || val < SHRT_MIN || val > SHRT_MAX)
+        {
+            return false;
+        }
+        os->write(static_cast<int16_t>(val));
+        return true;
+    }
+    case PrimitiveInfo::KindInt:
+    {
+        long val = PyLong_AsLong(p);
+        if(PyErr_Occurred() || val < INT_MIN || val > INT_MAX)
+        {
+            return false;
+        }
+        os->write(static_cast<int32_t>(val));
+        return true;
+    }
+    case PrimitiveInfo::KindLong:
+    {
+        int64_t val = PyLong_AsLongLong(p);
+        if(PyErr_Occurred())
+        {
+            return false;
+        }
+        os->write(val);
+        return true;
+    }
+    case PrimitiveInfo::KindFloat:
+    {
+        double val;
+        if(PyFloat_Check(p))
+        {
+            val = PyFloat_AsDouble(p);
+            if(isfinite(val) && (val > numeric_limits<float>::max() || val < -numeric_limits<float>::max()))
+            {
+                return false;
+            }
+        }
+        else if(PyLong_Check(p))
+        {
+            val = PyLong_AsDouble(p);
+            if(PyErr_Occurred())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+        os->write(static_cast<float>(val));
+        return true;
+    }
+    case PrimitiveInfo::KindDouble:
+    {
+        double val;
+        if(PyFloat_Check(p))
+        {
+            val = PyFloat_AsDouble(p);
+        }
+        else if(PyLong_Check(p))
+        {
+            val = PyLong_AsDouble(p);
+            if(PyErr_Occurred())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+        os->write(val);
+        return true;
+    }
+    case PrimitiveInfo::KindString:
+    {
+        if(p != Py_None && !checkString(p))
+        {
+            return false;
+        }
+        if(!writeString(p, os))
+        {
+            assert(PyErr_Occurred());
+            throw AbortMarshaling();
+        }
+        return true;
+    }
+    }
+
+    assert(false);
+    return false;
+}
+
+//
+// Unmarshal a primitive struct member, returns a new reference.
+//
+static PyObject*
+unmarshalPrimitiveMember(PrimitiveInfo::Kind kind, Ice::InputStream* is)
+{
+    switch(kind)
+    {
+    case PrimitiveInfo::KindBool:
+    {
+        bool val;
+        is->read(val);
+        return val ? incTrue() : incFalse();
+    }
+    case PrimitiveInfo::KindByte:
+    {
+        Ice::Byte val;
+        is->read(val);
+        return PyLong_FromLong(val);
+    }
+    case PrimitiveInfo::KindShort:
+    {
+        int16_t val;
+        is->read(val);
+        return PyLong_FromLong(val);
+    }
+    case PrimitiveInfo::KindInt:
+    {
+        int32_t val;
+        is->read(val);
+        return PyLong_FromLong(val);
+    }
+    case PrimitiveInfo::KindLong:
+    {
+        int64_t val;
+        is->read(val);
+        return PyLong_FromLongLong(val);
+    }
+    case PrimitiveInfo::KindFloat:
+    {
+        float val;
+        is->read(val);
+        return PyFloat_FromDouble(val);
+    }
+    case PrimitiveInfo::KindDouble:
+    {
+        double val;
+        is->read(val);
+        return PyFloat_FromDouble(val);
+    }
+    case PrimitiveInfo::KindString:
+    {
+        string val;
+        is->read(val, false); // Bypass string conversion.
+        return createString(val);
+    }
+    }
+
+    assert(false);
+    return 0;
+}
+
 //
 // StructInfo implementation.
 //
@@ -1246,13 +1545,43 @@ IcePy::StructInfo::StructInfo(string ident, PyObject* t, PyObject* m) :
 
     _variableLength = false;
     _wireSize = 0;
-    for(DataMemberList::const_iterator p = members.begin(); p != members.end(); ++p)
+    _packedSize = 0;
+    bool packed = !members.empty();
+    for(const auto& member : members)
     {
-        if(!_variableLength && (*p)->type->variableLength())
+        if(!_variableLength && member->type->variableLength())
         {
             _variableLength = true;
         }
-        _wireSize += (*p)->type->wireSize();
+        _wireSize += member->type->wireSize();
+
+        MemberPlan plan;
+        plan.member = member;
+        plan.name = PyUnicode_InternFromString(member->name.c_str());
+        plan.primitive = dynamic_cast<const PrimitiveInfo*>(member->type.get());
+        _plan.push_back(plan);
+
+        auto nested = dynamic_cast<const StructInfo*>(member->type.get());
+        if(plan.primitive && plan.primitive->kind != PrimitiveInfo::KindString)
+        {
+            _packedSize += member->type->wireSize();
+            _packedKinds.push_back(plan.primitive->kind);
+        }
+        else if(nested && nested->packedSize() > 0)
+        {
+            _packedSize += nested->packedSize();
+            _packedKinds.insert(_packedKinds.end(), nested->packedKinds().begin(), nested->packedKinds().end());
+        }
+        else
+        {
+            packed = false;
+        }
+    }
+
+    if(!packed)
+    {
+        _packedSize = 0;
+        _packedKinds.clear();
     }
 }
 
@@ -1331,17 +1660,27 @@ IcePy::StructInfo::marshal(PyObject* p, Ice::OutputStream* os, ObjectMap* object
         }
     }
 
-    for(DataMemberList::const_iterator q = members.begin(); q != members.end(); ++q)
+    for(const auto& plan : _plan)
     {
-        DataMemberPtr member = *q;
+        const DataMemberPtr& member = plan.member;
         char* memberName = const_cast<char*>(member->name.c_str());
-        PyObjectHandle attr = getAttr(p, member->name, true);
+        PyObjectHandle attr = PyObject_GetAttr(p, plan.name.get());
         if(!attr.get())
         {
             PyErr_Format(PyExc_AttributeError, STRCAST("no member `%s' found in %s value"), memberName,
                          const_cast<char*>(id.c_str()));
             throw AbortMarshaling();
         }
+        if(plan.primitive)
+        {
+            if(!marshalPrimitiveMember(plan.primitive->kind, attr.get(), os))
+            {
+                PyErr_Format(PyExc_ValueError, STRCAST("invalid value for %s member `%s'"),
+                             const_cast<char*>(id.c_str()), memberName);
+                throw AbortMarshaling();
+            }
+            continue;
+        }
         if(!member->type->validate(attr.get()))
         {
             PyErr_Format(PyExc_ValueError, STRCAST("invalid value for %s member `%s'"), const_cast<char*>(id.c_str()),
@@ -1380,10 +1719,21 @@ IcePy::StructInfo::unmarshal(Ice::InputStream* is, const UnmarshalCallbackPtr& c
         }
     }
 
-    for(DataMemberList::const_iterator q = members.begin(); q != members.end(); ++q)
+    for(const auto& plan : _plan)
     {
-        DataMemberPtr member = *q;
-        member->type->unmarshal(is, member, p.get(), 0, false, &member->metaData);
+        if(plan.primitive)
+        {
+            PyObjectHandle val = unmarshalPrimitiveMember(plan.primitive->kind, is);
+            if(!val.get() || PyObject_SetAttr(p.get(), plan.name.get(), val.get()) < 0)
+            {
+                assert(PyErr_Occurred());
+                throw AbortMarshaling();
+            }
+        }
+        else
+        {
+            plan.member->type->unmarshal(is, plan.member, p.get(), 0, false, &plan.member->metaData);
+        }
     }
 
     cb->unmarshaled(p.get(), target, closure);
@@ -1427,6 +1777,7 @@ void
 IcePy::StructInfo::destroy()
 {
     const_cast<DataMemberList&>(members).clear();
+    _plan.clear();
     _nullMarshalValue = 0;
 }
 
@@ -1438,6 +1789,185 @@ IcePy::StructInfo::instantiate(PyObject* pythonType)
     return type->tp_new(type, args.get(), 0);
 }
 
+int
+IcePy::StructInfo::packedSize() const
+{
+    return _packedSize;
+}
+
+const vector<IcePy::PrimitiveInfo::Kind>&
+IcePy::StructInfo::packedKinds() const
+{
+    return _packedKinds;
+}
+
+//
+// Parse a buffer format string (see the struct module and PEP 3118) and append the
+// primitive kinds of its items to kinds, with the members of T{...} sub-structures
+// flattened. Returns false if an item has no matching primitive kind or isn't encoded
+// in little-endian byte order, or if the format describes more than maxKinds items.
+//
+static bool
+parseBufferFormat(const char*& p, bool native, vector<PrimitiveInfo::Kind>& kinds, size_t maxKinds, bool nested)
+{
+    while(*p != '\0')
+    {
+        if(isspace(static_cast<unsigned char>(*p)))
+        {
+            ++p;
+            continue;
+        }
+
+        switch(*p)
+        {
+            case '}':
+            {
+                ++p;
+                return nested;
+            }
+            case '@':
+            {
+                native = true;
+                ++p;
+                continue;
+            }
+            case '=':
+            case '<':
+            {
+                native = false;
+                ++p;
+                continue;
+            }
+            case ':':
+            {
+                //
+                // Skip the item name.
+                //
+                p = strchr(p + 1, ':');
+                if(!p)
+                {
+                    return false;
+                }
+                ++p;
+                continue;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        size_t count = 1;
+        if(isdigit(static_cast<unsigned char>(*p)))
+        {
+            char* end;
+            count = strtoul(p, &end, 10);
+            p = end;
+        }
+
+        vector<PrimitiveInfo::Kind> item;
+        if(p[0] == 'T' && p[1] == '{')
+        {
+            p += 2;
+            if(!parseBufferFormat(p, native, item, maxKinds, true))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            switch(*p)
+            {
+                case '?':
+                    item.push_back(PrimitiveInfo::KindBool);
+                    break;
+                case 'b':
+                case 'B':
+                    item.push_back(PrimitiveInfo::KindByte);
+                    break;
+                case 'h':
+                    item.push_back(PrimitiveInfo::KindShort);
+                    break;
+                case 'i':
+                    item.push_back(PrimitiveInfo::KindInt);
+                    break;
+                case 'l':
+                    //
+                    // The native size of 'l' is the size of a C long, the standard size is 4.
+                    //
+                    item.push_back(native && sizeof(long) == 8 ? PrimitiveInfo::KindLong : PrimitiveInfo::KindInt);
+                    break;
+                case 'q':
+                    item.push_back(PrimitiveInfo::KindLong);
+                    break;
+                case 'f':
+                    item.push_back(PrimitiveInfo::KindFloat);
+                    break;
+                case 'd':
+                    item.push_back(PrimitiveInfo::KindDouble);
+                    break;
+                default:
+                    return false; // Big-endian items, padding, unsigned integers, arrays, etc.
+            }
+            ++p;
+        }
+
+        if(count > maxKinds || kinds.size() + count * item.size() > maxKinds)
+        {
+            return false;
+        }
+        for(size_t i = 0; i < count; ++i)
+        {
+            kinds.insert(kinds.end(), item.begin(), item.end());
+        }
+    }
+    return !nested;
+}
+
+//
+// Marshal a sequence of structs from an object which implements the buffer protocol,
+// such as a NumPy structured array, whose items are the packed structs. Returns false
+// if the object isn't a C-contiguous buffer whose item format matches the kinds of the
+// struct members, in which case the caller marshals the sequence element by element.
+// A buffer without a format holds unsigned bytes, which only match a struct of bytes.
+//
+static bool
+marshalPackedStructSequence(const StructInfo* info, PyObject* p, Ice::OutputStream* os)
+{
+#ifdef ICE_BIG_ENDIAN
+    return false; // The wire encoding is little-endian.
+#else
+    const int packedSize = info ? info->packedSize() : 0;
+    if(packedSize == 0 || !PyObject_CheckBuffer(p))
+    {
+        return false;
+    }
+
+    Py_buffer pybuf;
+    if(PyObject_GetBuffer(p, &pybuf, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0)
+    {
+        PyErr_Clear(); // PyObject_GetBuffer sets an exception on failure.
+        return false;
+    }
+
+    bool packed = pybuf.itemsize == packedSize && pybuf.len % packedSize == 0;
+    if(packed)
+    {
+        const vector<PrimitiveInfo::Kind>& expected = info->packedKinds();
+        vector<PrimitiveInfo::Kind> kinds;
+        const char* format = pybuf.format ? pybuf.format : "B";
+        packed = parseBufferFormat(format, true, kinds, expected.size(), false) && kinds == expected;
+    }
+    if(packed)
+    {
+        os->writeSize(static_cast<int32_t>(pybuf.len / packedSize));
+        os->writeBlob(static_cast<const Ice::Byte*>(pybuf.buf), static_cast<size_t>(pybuf.len));
+    }
+    PyBuffer_Release(&pybuf);
+    return packed;
+#endif
+}
+
 //
 // SequenceInfo implementation.
 //
@@ -1518,11 +2048,12 @@ IcePy::SequenceInfo::marshal(PyObject* p, Ice::OutputStream* os, ObjectMap* obje
                 const void* buf = 0;
                 if(PyObject_AsReadBuffer(p, &buf, &sz) == 0)
                 {
-                    if(pi->kind == PrimitiveInfo::KindString)
+                    if(pi && pi->kind == PrimitiveInfo::KindString)
                     {
                         PyErr_Format(PyExc_ValueError, STRCAST("expected sequence value"));
                         throw AbortMarshaling();
                     }
+                    sz /= elementType->wireSize(); // The buffer size is in bytes.
                 }
                 else
                 {
@@ -1540,7 +2071,7 @@ IcePy::SequenceInfo::marshal(PyObject* p, Ice::OutputStream* os, ObjectMap* obje
                     if(!fs.get())
                     {
                         assert(PyErr_Occurred());
-                        return;
+                        throw AbortMarshaling();
                     }
                     sz = PySequence_Fast_GET_SIZE(fs.get());
                 }
@@ -1559,12 +2090,13 @@ IcePy::SequenceInfo::marshal(PyObject* p, Ice::OutputStream* os, ObjectMap* obje
     {
         marshalPrimitiveSequence(pi, p, os);
     }
-    else
+    else if(!marshalPackedStructSequence(dynamic_cast<const StructInfo*>(elementType.get()), p, os))
     {
         PyObjectHandle fastSeq = PySequence_Fast(p, STRCAST("expected a sequence value"));
         if(!fastSeq.get())
         {
-            return;
+            assert(PyErr_Occurred());
+            throw AbortMarshaling();
         }
 
         Py_ssize_t sz = PySequence_Fast_GET_SIZE(fastSeq.get());
@@ -1618,13 +2150,11 @@ IcePy::SequenceInfo::unmarshal(Ice::InputStream* is, const UnmarshalCallbackPtr&
     if(metaData)
     {
         SequenceMapping::Type type;
-        if(!SequenceMapping::getType(*metaData, type) || type == mapping->type)
-        {
-            sm = mapping;
-        }
-        else
+        bool copy = SequenceMapping::getCopy(*metaData);
+        if(SequenceMapping::getType(*metaData, type) && (type != mapping->type || copy != mapping->copy))
         {
             sm = make_shared<SequenceMapping>(type);
+            sm->copy = copy;
             try
             {
                 sm->init(*metaData);
@@ -1634,6 +2164,15 @@ IcePy::SequenceInfo::unmarshal(Ice::InputStream* is, const UnmarshalCallbackPtr&
                 throw AbortMarshaling();
             }
         }
+        else if(!copy && mapping->copy)
+        {
+            sm = make_shared<SequenceMapping>(*mapping);
+            sm->copy = false;
+        }
+        else
+        {
+            sm = mapping;
+        }
     }
     else
     {
@@ -2095,18 +2634,63 @@ IcePy::SequenceInfo::marshalPrimitiveSequence(const PrimitiveInfoPtr& pi, PyObje
 PyObject*
 IcePy::SequenceInfo::createSequenceFromMemory(
     const SequenceMappingPtr& sm,
+    Ice::InputStream* is,
     const char* buffer,
     Py_ssize_t size,
     BuiltinType type)
 {
     PyObjectHandle memoryview;
-    char* buf = const_cast<char*>(size == 0 ? emptySeq : buffer);
-    memoryview = PyMemoryView_FromMemory(buf, size, PyBUF_READ);
+    bool copy = true;
+    if(!sm->copy && size > 0)
+    {
+        StreamUtil* util = reinterpret_cast<StreamUtil*>(is->getClosure());
+        assert(util);
+        memoryview = util->createView(buffer, size);
+        copy = !memoryview.get();
+    }
 
     if(!memoryview.get())
     {
-        assert(PyErr_Occurred());
-        throw AbortMarshaling();
+        char* buf = const_cast<char*>(size == 0 ? emptySeq : buffer);
+        if(sm->factory)
+        {
+            memoryview = PyMemoryView_FromMemory(buf, size, PyBUF_READ);
+        }
+        else
+        {
+            //
+            // Without a factory the sequence is mapped to a memoryview, copy the bytes
+            // since the stream bytes aren't retained.
+            //
+            PyObjectHandle bytes = PyBytes_FromStringAndSize(buf, size);
+            if(bytes.get())
+            {
+                memoryview = PyMemoryView_FromObject(bytes.get());
+            }
+        }
+
+        if(!memoryview.get())
+        {
+            assert(PyErr_Occurred());
+            throw AbortMarshaling();
+        }
+    }
+
+    if(!sm->factory)
+    {
+        //
+        // A python:nocopy sequence without a factory is mapped to a read-only memoryview
+        // with the format of the element type.
+        //
+        static const char* formats[] = { "?", "B", "h", "i", "q", "f", "d" };
+        PyObject* result = PyObject_CallMethod(memoryview.get(), STRCAST("cast"), STRCAST("s"),
+                                               formats[static_cast<int>(type)]);
+        if(!result)
+        {
+            assert(PyErr_Occurred());
+            throw AbortMarshaling();
+        }
+        return result;
     }
 
     PyObjectHandle builtinType = PyLong_FromLong(static_cast<int>(type));
@@ -2121,7 +2705,7 @@ IcePy::SequenceInfo::createSequenceFromMemory(
     PyObjectHandle args = PyTuple_New(3);
     PyTuple_SET_ITEM(args.get(), 0, incRef(memoryview.get()));
     PyTuple_SET_ITEM(args.get(), 1, incRef(builtinType.get()));
-    PyTuple_SET_ITEM(args.get(), 2, incTrue());
+    PyTuple_SET_ITEM(args.get(), 2, copy ? incTrue() : incFalse());
     PyObjectHandle result = PyObject_Call(sm->factory, args.get(), 0);
 
     if(!result.get())
@@ -2151,10 +2735,10 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
         pair<const bool*, const bool*> p;
         is->read(p);
         int sz = static_cast<int>(p.second - p.first);
-        if(sm->factory)
+        if(sm->factory || !sm->copy)
         {
             const char* data = reinterpret_cast<const char*>(p.first);
-            result = createSequenceFromMemory(sm, data, sz, BuiltinTypeBool);
+            result = createSequenceFromMemory(sm, is, data, sz, BuiltinTypeBool);
         }
         else
         {
@@ -2177,9 +2761,10 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
         pair<const Ice::Byte*, const Ice::Byte*> p;
         is->read(p);
         int sz = static_cast<int>(p.second - p.first);
-        if(sm->factory)
+        if(sm->factory || !sm->copy)
         {
-            result = createSequenceFromMemory(sm, reinterpret_cast<const char*>(p.first), sz, BuiltinTypeByte);
+            const char* data = reinterpret_cast<const char*>(p.first);
+            result = createSequenceFromMemory(sm, is, data, sz, BuiltinTypeByte);
         }
         else if(sm->type == SequenceMapping::SEQ_DEFAULT)
         {
@@ -2217,10 +2802,10 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
         pair<const int16_t*, const int16_t*> p;
         is->read(p);
         int sz = static_cast<int>(p.second - p.first);
-        if(sm->factory)
+        if(sm->factory || !sm->copy)
         {
             const char* data = reinterpret_cast<const char*>(p.first);
-            result = createSequenceFromMemory(sm, data, sz * 2, BuiltinTypeShort);
+            result = createSequenceFromMemory(sm, is, data, sz * 2, BuiltinTypeShort);
         }
         else
         {
@@ -2249,10 +2834,10 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
         pair<const int32_t*, const int32_t*> p;
         is->read(p);
         int sz = static_cast<int>(p.second - p.first);
-        if(sm->factory)
+        if(sm->factory || !sm->copy)
         {
             const char* data = reinterpret_cast<const char*>(p.first);
-            result = createSequenceFromMemory(sm, data, sz * 4, BuiltinTypeInt);
+            result = createSequenceFromMemory(sm, is, data, sz * 4, BuiltinTypeInt);
         }
         else
         {
@@ -2280,10 +2865,10 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
         pair<const int64_t*, const int64_t*> p;
         is->read(p);
         int sz = static_cast<int>(p.second - p.first);
-        if(sm->factory)
+        if(sm->factory || !sm->copy)
         {
             const char* data = reinterpret_cast<const char*>(p.first);
-            result = createSequenceFromMemory(sm, data, sz * 8, BuiltinTypeLong);
+            result = createSequenceFromMemory(sm, is, data, sz * 8, BuiltinTypeLong);
         }
         else
         {
@@ -2312,10 +2897,10 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
         pair<const float*, const float*> p;
         is->read(p);
         int sz = static_cast<int>(p.second - p.first);
-        if(sm->factory)
+        if(sm->factory || !sm->copy)
         {
             const char* data = reinterpret_cast<const char*>(p.first);
-            result = createSequenceFromMemory(sm, data, sz * 4, BuiltinTypeFloat);
+            result = createSequenceFromMemory(sm, is, data, sz * 4, BuiltinTypeFloat);
         }
         else
         {
@@ -2344,10 +2929,10 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
         pair<const double*, const double*> p;
         is->read(p);
         int sz = static_cast<int>(p.second - p.first);
-        if(sm->factory)
+        if(sm->factory || !sm->copy)
         {
             const char* data = reinterpret_cast<const char*>(p.first);
-            result = createSequenceFromMemory(sm, data, sz * 8, BuiltinTypeDouble);
+            result = createSequenceFromMemory(sm, is, data, sz * 8, BuiltinTypeDouble);
         }
         else
         {
@@ -2399,6 +2984,12 @@ IcePy::SequenceInfo::unmarshalPrimitiveSequence(const PrimitiveInfoPtr& pi, Ice:
     cb->unmarshaled(result.get(), target, closure);
 }
 
+bool
+IcePy::SequenceInfo::SequenceMapping::getCopy(const Ice::StringSeq& metaData)
+{
+    return find(metaData.begin(), metaData.end(), "python:nocopy") == metaData.end();
+}
+
 bool
 IcePy::SequenceInfo::SequenceMapping::getType(const Ice::StringSeq& metaData, Type& t)
 {
@@ -2440,12 +3031,14 @@ IcePy::SequenceInfo::SequenceMapping::getType(const Ice::StringSeq& metaData, Ty
 
 IcePy::SequenceInfo::SequenceMapping::SequenceMapping(Type t) :
     type(t),
-    factory(0)
+    factory(0),
+    copy(true)
 {
 }
 
 IcePy::SequenceInfo::SequenceMapping::SequenceMapping(const Ice::StringSeq& meta) :
-    factory(0)
+    factory(0),
+    copy(getCopy(meta))
 {
     if(!getType(meta, type))
     {
@@ -4255,6 +4848,59 @@ PyTypeObject ExceptionInfoType =
     0,                               /* tp_is_gc */
 };
 
+static PyBufferProcs BufferAsBuffer =
+{
+    reinterpret_cast<getbufferproc>(bufferGetBuffer), /* bf_getbuffer */
+    0,                               /* bf_releasebuffer */
+};
+
+PyTypeObject BufferType =
+{
+    /* The ob_type field must be initialized in the module init function
+     * to be portable to Windows without using C++. */
+    PyVarObject_HEAD_INIT(0, 0)
+    STRCAST("IcePy.Buffer"),         /* tp_name */
+    sizeof(BufferObject),            /* tp_basicsize */
+    0,                               /* tp_itemsize */
+    /* methods */
+    reinterpret_cast<destructor>(bufferDealloc), /* tp_dealloc */
+    0,                               /* tp_print */
+    0,                               /* tp_getattr */
+    0,                               /* tp_setattr */
+    0,                               /* tp_reserved */
+    0,                               /* tp_repr */
+    0,                               /* tp_as_number */
+    0,                               /* tp_as_sequence */
+    0,                               /* tp_as_mapping */
+    0,                               /* tp_hash */
+    0,                               /* tp_call */
+    0,                               /* tp_str */
+    0,                               /* tp_getattro */
+    0,                               /* tp_setattro */
+    &BufferAsBuffer,                 /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,              /* tp_flags */
+    0,                               /* tp_doc */
+    0,                               /* tp_traverse */
+    0,                               /* tp_clear */
+    0,                               /* tp_richcompare */
+    0,                               /* tp_weaklistoffset */
+    0,                               /* tp_iter */
+    0,                               /* tp_iternext */
+    0,                               /* tp_methods */
+    0,                               /* tp_members */
+    0,                               /* tp_getset */
+    0,                               /* tp_base */
+    0,                               /* tp_dict */
+    0,                               /* tp_descr_get */
+    0,                               /* tp_descr_set */
+    0,                               /* tp_dictoffset */
+    0,                               /* tp_init */
+    0,                               /* tp_alloc */
+    reinterpret_cast<newfunc>(bufferNew), /* tp_new */
+    0,                               /* tp_free */
+    0,                               /* tp_is_gc */
+};
+
 static PyNumberMethods UnsetAsNumber =
 {
     0,                          /* nb_add */
@@ -4357,6 +5003,11 @@ IcePy::initTypes(PyObject* module)
         return false;
     }
 
+    if(PyType_Ready(&BufferType) < 0)
+    {
+        return false;
+    }
+
     PrimitiveInfoPtr boolType = make_shared<PrimitiveInfo>(PrimitiveInfo::KindBool);
     PyObjectHandle boolTypeObj = createType(boolType);
     if(PyModule_AddObject(module, STRCAST("_t_bool"), boolTypeObj.get()) < 0)
@@ -4468,6 +5119,20 @@ IcePy::createException(const ExceptionInfoPtr& info)
     return reinterpret_cast<PyObject*>(obj);
 }
 
+PyObject*
+IcePy::createBuffer(const BufferPtr& buffer, const Ice::Byte* data, Py_ssize_t size)
+{
+    assert(data >= buffer->begin() && data + size <= buffer->end());
+    BufferObject* obj = bufferNew(&BufferType, 0, 0);
+    if(obj)
+    {
+        obj->buffer = new IcePy::BufferPtr(buffer);
+        obj->data = data;
+        obj->size = size;
+    }
+    return reinterpret_cast<PyObject*>(obj);
+}
+
 extern "C"
 PyObject*
 IcePy_defineEnum(PyObject*, PyObject* args)
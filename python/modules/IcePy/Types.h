@@ -91,6 +91,24 @@ private:
 };
 using ReadValueCallbackPtr = std::shared_ptr<ReadValueCallback>;
 
+//
+// The bytes of a received message, retained by the sequences which reference them
+// instead of copying them (see the python:nocopy metadata).
+//
+class Buffer
+{
+public:
+
+    Buffer(std::vector<Ice::Byte>&&);
+
+    const Ice::Byte* begin() const;
+    const Ice::Byte* end() const;
+
+private:
+
+    const std::vector<Ice::Byte> _bytes;
+};
+
 //
 // This class assists during unmarshaling of Slice classes and exceptions.
 // We attach an instance to a stream.
@@ -102,6 +120,18 @@ public:
     StreamUtil();
     ~StreamUtil();
 
+    //
+    // Set the bytes read by the stream and the buffer retaining them, if any.
+    //
+    void setBytes(const std::pair<const Ice::Byte*, const Ice::Byte*>&, const BufferPtr& = nullptr);
+
+    //
+    // Create a read-only memoryview of the given stream bytes which keeps them alive. The
+    // stream bytes are copied once into a buffer if they're not already retained by one.
+    // Returns null if the given bytes aren't stream bytes.
+    //
+    PyObject* createView(const char*, Py_ssize_t);
+
     //
     // Keep a reference to a ReadValueCallback for patching purposes.
     //
@@ -124,6 +154,8 @@ private:
 
     std::vector<ReadValueCallbackPtr> _callbacks;
     std::set<ValueReaderPtr> _readers;
+    std::pair<const Ice::Byte*, const Ice::Byte*> _bytes;
+    BufferPtr _buffer;
     static PyObject* _slicedDataType;
     static PyObject* _sliceInfoType;
 };
@@ -287,14 +319,42 @@ public:
 
     static PyObject* instantiate(PyObject*);
 
+    //
+    // The wire size of the struct if its members are all fixed-size primitives or
+    // structs, 0 otherwise. The wire encoding of such a struct is the same as its
+    // packed in-memory layout on little-endian platforms.
+    //
+    int packedSize() const;
+
+    //
+    // The primitive kinds of the members of a packed struct in wire order, with the
+    // members of nested structs flattened. Empty if the struct isn't packed.
+    //
+    const std::vector<PrimitiveInfo::Kind>& packedKinds() const;
+
     const std::string id;
     const DataMemberList members;
     PyObject* pythonType; // Borrowed reference - the enclosing Python module owns the reference.
 
 private:
 
+    //
+    // The members compiled into a flat marshaling plan when the struct is defined.
+    // The member names are interned and primitive members are converted inline
+    // instead of through their type information.
+    //
+    struct MemberPlan
+    {
+        DataMemberPtr member;
+        PyObjectHandle name;
+        const PrimitiveInfo* primitive; // Null if the member isn't a primitive.
+    };
+
     bool _variableLength;
     int _wireSize;
+    int _packedSize;
+    std::vector<PrimitiveInfo::Kind> _packedKinds;
+    std::vector<MemberPlan> _plan;
     PyObjectHandle _nullMarshalValue;
 };
 using StructInfoPtr = std::shared_ptr<StructInfo>;
@@ -349,6 +409,7 @@ private:
         void init(const Ice::StringSeq&);
 
         static bool getType(const Ice::StringSeq&, Type&);
+        static bool getCopy(const Ice::StringSeq&);
 
         virtual void unmarshaled(PyObject*, PyObject*, void*);
 
@@ -357,6 +418,7 @@ private:
 
         Type type;
         PyObject* factory;
+        bool copy; // False if the sequence can reference the stream bytes (python:nocopy).
     };
     using SequenceMappingPtr = std::shared_ptr<SequenceMapping>;
 
@@ -365,7 +427,8 @@ private:
     void unmarshalPrimitiveSequence(const PrimitiveInfoPtr&, Ice::InputStream*, const UnmarshalCallbackPtr&,
                                     PyObject*, void*, const SequenceMappingPtr&);
 
-    PyObject* createSequenceFromMemory(const SequenceMappingPtr&, const char*, Py_ssize_t, BuiltinType);
+    PyObject* createSequenceFromMemory(const SequenceMappingPtr&, Ice::InputStream*, const char*, Py_ssize_t,
+                                       BuiltinType);
 
 public:
 
@@ -732,7 +795,7 @@ TypeInfoPtr getType(PyObject*);
 PyObject* createException(const ExceptionInfoPtr&);
 ExceptionInfoPtr getException(PyObject*);
 
-PyObject* createBuffer(const BufferPtr&);
+PyObject* createBuffer(const BufferPtr&, const Ice::Byte*, Py_ssize_t);
 
 }
 
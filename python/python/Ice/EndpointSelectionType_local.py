@@ -30,6 +30,9 @@ if "EndpointSelectionType" not in _M_Ice.__dict__:
         Enumerators:
         Random --  Random causes the endpoints to be arranged in a random order.
         Ordered --  Ordered forces the Ice run time to use the endpoints in the order they appeared in the proxy.
+        Adaptive --  Adaptive causes the endpoints to be arranged by increasing cost, the cost of an endpoint being
+        its recent invocation latency weighted by its number of outstanding invocations. The connection is selected
+        for each invocation, as if the proxy didn't cache its connection.
         """
 
         def __init__(self, _n, _v):
@@ -44,9 +47,11 @@ if "EndpointSelectionType" not in _M_Ice.__dict__:
 
     EndpointSelectionType.Random = EndpointSelectionType("Random", 0)
     EndpointSelectionType.Ordered = EndpointSelectionType("Ordered", 1)
+    EndpointSelectionType.Adaptive = EndpointSelectionType("Adaptive", 2)
     EndpointSelectionType._enumerators = {
         0: EndpointSelectionType.Random,
         1: EndpointSelectionType.Ordered,
+        2: EndpointSelectionType.Adaptive,
     }
 
     _M_Ice._t_EndpointSelectionType = IcePy.defineEnum(
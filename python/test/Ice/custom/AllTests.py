@@ -6,6 +6,7 @@ import sys
 import Ice
 import Test
 import array
+import ctypes
 
 
 def test(b):
@@ -351,6 +352,89 @@ def allTests(helper, communicator):
 
     print("ok")
 
+    sys.stdout.write("testing python:nocopy... ")
+    sys.stdout.flush()
+
+    v = [1, 2, 3, 4]
+    v1, v2, v3 = custom.opNoCopySeq(v)
+    test(isinstance(v1, memoryview) and v1.readonly and v1.format == "i" and v1.tolist() == v)
+    test(isinstance(v2, memoryview) and v2.readonly and v2.format == "d" and v2.tolist() == [1.0, 2.0, 3.0, 4.0])
+    test(isinstance(v3, memoryview) and v3.readonly and v3.format == "B" and v3.tolist() == v)
+
+    v1, v2, v3 = custom.opNoCopySeqAsync(array.array("i", v)).result()
+    test(v1.tolist() == v and v2.tolist() == [1.0, 2.0, 3.0, 4.0] and v3.tolist() == v)
+
+    v1, v2, v3 = custom.opNoCopySeq([])
+    test(len(v1) == 0 and len(v2) == 0 and len(v3) == 0)
+
+    print("ok")
+
+    sys.stdout.write("testing struct sequences... ")
+    sys.stdout.flush()
+
+    points = [Test.Point(i, -i) for i in range(10)]
+    test(custom.opPointSeq(points) == points)
+    test(custom.opPointSeq([]) == [])
+
+    samples = [Test.Sample(i % 2 == 0, i, -i, i * 1000, -i * 100000000000, i + 0.5, i - 0.25, Test.Point(i, i),
+                           "sample{0}".format(i)) for i in range(10)]
+    test(custom.opSampleSeq(samples) == samples)
+
+    try:
+        custom.opSampleSeq([Test.Sample(s=100000)])
+        test(False)
+    except ValueError:
+        pass
+
+    try:
+        custom.opPointSeq([Test.Point(1, 2), Test.Line()])
+        test(False)
+    except ValueError:
+        pass
+
+    # Sequences of structs whose members are all fixed-size primitives are marshaled directly from buffers whose
+    # item format matches the struct members.
+    class Point(ctypes.Structure):
+        _fields_ = [("x", ctypes.c_int32), ("y", ctypes.c_int32)]
+
+    class Line(ctypes.Structure):
+        _fields_ = [("a", Point), ("b", Point)]
+
+    class BigEndianPoint(ctypes.BigEndianStructure):
+        _fields_ = [("x", ctypes.c_int32), ("y", ctypes.c_int32)]
+
+    v = (Point * 10)(*[Point(i, -i) for i in range(10)])
+    test(custom.opPointSeq(v) == points)
+    test(custom.opPointSeq(memoryview(v)) == points)
+    test(custom.opPointSeq((Point * 0)()) == [])
+
+    v = (Line * 3)(*[Line(Point(i, i + 1), Point(-i, -i - 1)) for i in range(3)])
+    test(custom.opLineSeq(v) == [Test.Line(Test.Point(i, i + 1), Test.Point(-i, -i - 1)) for i in range(3)])
+
+    # The item size matches the struct size but not the item format.
+    for v in [array.array("q", [1, 2, 3]), array.array("d", [1.0, 2.0, 3.0])]:
+        try:
+            custom.opPointSeq(v)
+            test(False)
+        except ValueError:
+            pass
+
+    # Byte-swapped items.
+    try:
+        custom.opPointSeq((BigEndianPoint * 3)(BigEndianPoint(1, 2)))
+        test(False)
+    except ValueError:
+        pass
+
+    # Non-contiguous buffer.
+    try:
+        custom.opPointSeq(memoryview((Point * 6)())[::2])
+        test(False)
+    except NotImplementedError:
+        pass
+
+    print("ok")
+
     try:
         import numpy
 
@@ -116,6 +116,10 @@ class CustomI(Test.Custom):
         test(isinstance(v1, array.array))
         return v1, v1
 
+    def opNoCopySeq(self, v1, current):
+        test(isinstance(v1, memoryview) and v1.readonly and v1.format == "i")
+        return v1, [float(i) for i in v1], bytes(v1.tolist())
+
     def opBogusArrayNotExistsFactory(self, current):
         return [True, False, True, False]
 
@@ -137,6 +141,15 @@ class CustomI(Test.Custom):
     def opD(self, d, current):
         return d
 
+    def opPointSeq(self, v, current):
+        return v
+
+    def opLineSeq(self, v, current):
+        return v
+
+    def opSampleSeq(self, v, current):
+        return v
+
     def shutdown(self, current=None):
         current.adapter.getCommunicator().shutdown()
 
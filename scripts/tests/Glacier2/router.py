@@ -31,8 +31,13 @@ traceProps = {
 }
 
 
-def buffered(enabled):
-    return {"Glacier2.Client.Buffered": enabled, "Glacier2.Server.Buffered": enabled}
+def buffered(enabled, threads=1):
+    return {
+        "Glacier2.Client.Buffered": enabled,
+        "Glacier2.Server.Buffered": enabled,
+        "Glacier2.Client.RequestQueueThreads": threads,
+        "Glacier2.Server.RequestQueueThreads": threads,
+    }
 
 
 Glacier2TestSuite(
@@ -57,5 +62,14 @@ Glacier2TestSuite(
             clients=[Client(), Client(args=["--shutdown"])],
             traceProps=traceProps,
         ),
+        ClientServerTestCase(
+            name="client/server with router in buffered mode with several request queue threads",
+            servers=[
+                Glacier2Router(passwords=passwords, props=buffered(True, 3)),
+                Server(),
+            ],
+            clients=[Client(), Client(args=["--shutdown"])],
+            traceProps=traceProps,
+        ),
     ],
 )